@@ -23,6 +23,10 @@
 
 #include <limits.h>
 
+#if TFT_ENABLE_READBACK && TFT_ENABLE_IMAGES && TFT_TUNE_EEPROM
+#include <EEPROM.h>
+#endif
+
 /*!
     @brief  Instantiate Adafruit ILI9341 driver with hardware SPI using the
             default SPI peripheral.
@@ -31,7 +35,16 @@
     @param  rst  Reset pin ## (required).
 */
 AVR_ILI9341::AVR_ILI9341(int8_t cs, int8_t dc, int8_t rst)
-    : TFT_SPI(cs, dc, rst) {}
+    : TFT_SPI(cs, dc, rst) {
+  _scrollTop = 0;  // Scrolling definition after reset.
+  _scrollHeight = TFT_HEIGHT;
+  _table = NULL;
+  _ctrld = 0;
+  _brightness = 0xFF;
+  _cabc = CabcOff;
+  _cabcMin = 0;
+  _bckctrSet = 0;
+}
 
 // clang-format off
 // TFT LCD(ILI9341V) startup configuration is available here: 
@@ -68,10 +81,235 @@ static const uint8_t PROGMEM initcmd[] = {
     @brief   Initialize ILI9341 chip. Connects to the ILI9341 over SPI
                 and sends initialization procedure commands
     @param    freq  Desired SPI clock frequency
+    @param    tune  true to pick the write clock with autoTune(), freq is
+                    then the highest clock tried (TFT_TUNE_MAX_FREQ if 0).
+                    Needs TFT_ENABLE_READBACK and TFT_ENABLE_IMAGES.
 */
-void AVR_ILI9341::begin(uint32_t freq) {
+void AVR_ILI9341::begin(uint32_t freq, bool tune) {
   initSPI(freq);
+  sendInitScript();
+  _table = NULL;
+  _ctrld = 0;
+  _cabc = CabcOff;
+  _bckctrSet = 0;
+
+#if TFT_ENABLE_READBACK && TFT_ENABLE_IMAGES
+  if (tune) autoTune(freq ? freq : TFT_TUNE_MAX_FREQ);
+#else
+  (void)tune;
+#endif
+}
 
+/*!
+    @brief   Resets the display with a software reset and configures it
+             again, e.g. after an electrostatic discharge scrambled its
+             registers. The SPI clocks are kept, the rotation, the scroll
+             margins, the last table loaded, the brightness and the CABC
+             settings are restored; the scroll offset goes back to 0 and the
+             display memory must be drawn again.
+*/
+void AVR_ILI9341::reinit(void) {
+  SPI_START();
+  writeCommand(ILI9341_SWRESET);
+  SPI_END();
+  delay(150);  // 120 ms before Sleep Out after a reset.
+
+  sendInitScript();
+  if (_table) sendTable(_table, _tableP);
+  setRotation(rotation);
+  setScrollMargins(_scrollTop, TFT_HEIGHT - _scrollTop - _scrollHeight);
+  if (_ctrld) setBrightness(_brightness);
+  sendCABC();
+}
+
+/*!
+    @brief   Sets the duty cycle of the display's LEDPWM output, for modules
+             whose backlight driver is wired to it rather than to a board
+             pin. Turns the brightness control block on first. See
+             TFT_Backlight for fades and a perceptual curve.
+    @param   level  Duty cycle, 0 (off) to 255.
+*/
+void AVR_ILI9341::setBrightness(uint8_t level) {
+  _ctrld = CTRLD_BCTRL | CTRLD_BL;
+  _brightness = level;
+
+  SPI_START();
+  sendCommand(ILI9341_WRCTRLD, &_ctrld, 1);
+  sendCommand(ILI9341_WRDISBV, &_brightness, 1);
+  SPI_END();
+}
+
+/*!
+    @brief   Turns content adaptive brightness control on or off. With CABC
+             the display scans every frame and lowers its LEDPWM duty cycle
+             for dark content, raising the pixel values to compensate: a
+             mostly dark screen draws less backlight power. The duty cycle
+             of setBrightness() is the highest CABC uses. Like it, CABC
+             needs the backlight driver wired to the LEDPWM output.
+    @param   mode  CABC mode, from CabcOff to CabcMoving.
+    @param   minBrightness  Lowest duty cycle CABC may set, 0 to 255.
+*/
+void AVR_ILI9341::setCABC(cabcMode mode, uint8_t minBrightness) {
+  if (!_ctrld) setBrightness(_brightness);  // CABC needs BCTRL on.
+  _cabc = mode;
+  _cabcMin = minBrightness;
+  sendCABC();
+}
+
+/*!
+    @brief   Tunes how far each CABC mode dims (BCKCTR1-2). The display
+             finds the gray level that a share of the frame's pixels stay
+             under and dims the backlight as far as that level can be
+             raised to full scale, saturating the brighter pixels.
+    @param   ui  Share for CabcUI: 0 (99 %), 1 (98 %) then down to 15
+                 (70 %) in 2 % steps. Higher values dim more.
+    @param   still  Share for CabcStill, the same way.
+    @param   moving  Share for CabcMoving, the same way.
+*/
+void AVR_ILI9341::setCABCThreshold(uint8_t ui, uint8_t still,
+                                   uint8_t moving) {
+  _bckctr[0] = ui & 0x0F;
+  _bckctr[1] = (moving << 4) | (still & 0x0F);
+  _bckctrSet |= 1;
+  sendCABC();
+}
+
+/*!
+    @brief   Sets the lowest gray level each CABC mode scales from
+             (BCKCTR3-4), which limits the dimming on dark frames.
+    @param   ui  Level for CabcUI: 0 (252) to 15 (192) in steps of 4.
+                 Higher values dim more.
+    @param   still  Level for CabcStill, the same way.
+    @param   moving  Level for CabcMoving, the same way.
+*/
+void AVR_ILI9341::setCABCMinGray(uint8_t ui, uint8_t still, uint8_t moving) {
+  _bckctr[2] = ui & 0x0F;
+  _bckctr[3] = (moving << 4) | (still & 0x0F);
+  _bckctrSet |= 2;
+  sendCABC();
+}
+
+/*!
+    @brief   Sends the CABC thresholds set, the mode and the minimum
+             brightness.
+*/
+void AVR_ILI9341::sendCABC(void) {
+  SPI_START();
+  for (uint8_t i = 0; i < 4; i++) {
+    if (_bckctrSet & (1 << (i / 2))) {
+      sendCommand(ILI9341_BCKCTR1 + i, &_bckctr[i], 1);
+    }
+  }
+  if (_ctrld) {
+    sendCommand(ILI9341_WRCABC, &_cabc, 1);
+    sendCommand(ILI9341_WRCABCMB, &_cabcMin, 1);
+  }
+  SPI_END();
+}
+
+/*!
+    @brief   Replaces the gamma and power settings of the init script, e.g.
+             with a table tuned for a panel batch by extras/gamma_table.py.
+             The table has the init script's format: command, number of
+             data bytes, the data bytes, and so on up to a 0 (NOP) command.
+             Only the gamma (GAMMASET, GMCTRP1, GMCTRN1, DGMCTR1, DGMCTR2,
+             EN3GAM) and power (PWCTR1, PWCTR2, VMCTR1, VMCTR2, PWCTRA,
+             CMD_CF, POWSEQ, PUMPRAT) commands are taken, each with its
+             datasheet number of bytes.
+    @param   table  Table in RAM, kept by reinit(): it must stay valid.
+    @return  false if the table holds another command or a wrong number of
+             bytes, nothing is sent then.
+*/
+bool AVR_ILI9341::loadTable(const uint8_t *table) {
+  if (!sendTable(table, false)) return false;
+  _table = table;
+  _tableP = false;
+  return true;
+}
+
+/*!
+    @brief   Same as loadTable() for a table in PROGMEM.
+    @param   table  Table in PROGMEM.
+    @return  false if the table was refused, see loadTable().
+*/
+bool AVR_ILI9341::loadTable_P(const uint8_t *table) {
+  if (!sendTable(table, true)) return false;
+  _table = table;
+  _tableP = true;
+  return true;
+}
+
+/*!
+    @brief   Checks a table of gamma and power commands and sends it.
+    @param   table  Commands in the init script's format.
+    @param   progmem  true if the table is in PROGMEM.
+    @return  false if a command isn't allowed or has the wrong number of
+             bytes, nothing is sent then.
+*/
+bool AVR_ILI9341::sendTable(const uint8_t *table, bool progmem) {
+  uint8_t cmd, numArgs;
+  const uint8_t *addr = table;
+
+  // Check the whole table first so that a bad one changes nothing.
+  while ((cmd = progmem ? pgm_read_byte(addr) : *addr) > 0) {
+    numArgs = progmem ? pgm_read_byte(addr + 1) : addr[1];
+    if (numArgs != tableArgs(cmd)) return false;
+    addr += 2 + numArgs;
+  }
+
+  SPI_START();
+  addr = table;
+  while ((cmd = progmem ? pgm_read_byte(addr++) : *addr++) > 0) {
+    numArgs = progmem ? pgm_read_byte(addr++) : *addr++;
+    if (progmem) {
+      sendCommand_P(cmd, addr, numArgs);
+    } else {
+      sendCommand(cmd, addr, numArgs);
+    }
+    addr += numArgs;
+  }
+  SPI_END();
+  return true;
+}
+
+/*!
+    @brief   Returns the number of data bytes a table command takes.
+    @param   cmd  Command byte.
+    @return  The number of bytes, 0xFF for commands tables can't send.
+*/
+uint8_t AVR_ILI9341::tableArgs(uint8_t cmd) {
+  switch (cmd) {
+    case ILI9341_GAMMASET:
+    case ILI9341_EN3GAM:
+    case ILI9341_PWCTR1:
+    case ILI9341_PWCTR2:
+    case ILI9341_VMCTR2:
+    case ILI9341_PUMPRAT:
+      return 1;
+    case ILI9341_VMCTR1:
+      return 2;
+    case ILI9341_CMD_CF:
+      return 3;
+    case ILI9341_POWSEQ:
+      return 4;
+    case ILI9341_PWCTRA:
+      return 5;
+    case ILI9341_GMCTRP1:
+    case ILI9341_GMCTRN1:
+      return 15;
+    case ILI9341_DGMCTR1:
+      return 16;
+    case ILI9341_DGMCTR2:
+      return 64;
+    default:
+      return 0xFF;
+  }
+}
+
+/*!
+    @brief   Sends the initialization commands of initcmd.
+*/
+void AVR_ILI9341::sendInitScript(void) {
   SPI_START();
 
   uint8_t cmd, numArgs;
@@ -84,7 +322,7 @@ void AVR_ILI9341::begin(uint32_t freq) {
     }
 
     numArgs = pgm_read_byte(addr++);
-    sendCommand(cmd, addr, numArgs);
+    sendCommand_P(cmd, addr, numArgs);
     addr += numArgs;
   }
 
@@ -128,8 +366,11 @@ void AVR_ILI9341::setRotation(uint8_t m) {
 /*!
     @brief   Scroll display memory
     @param   y How many pixels to scroll display by
+    @note    `y` is the memory line shown first in the scroll area, along the
+             native 320-line axis whatever the rotation. See scrollArea().
 */
 void AVR_ILI9341::scrollTo(uint16_t y) {
+  TFT_PROFILE(TFT_PROF_SCROLL);
   uint8_t data[2];
   data[0] = y >> 8;
   data[1] = y & 0xff;
@@ -143,11 +384,15 @@ void AVR_ILI9341::scrollTo(uint16_t y) {
     @brief   Set the height of the Top and Bottom Scroll Margins
     @param   top The height of the Top scroll margin
     @param   bottom The height of the Bottom scroll margin
+    @note    The margins are in native memory lines whatever the rotation.
+             See setScrollArea().
  */
 void AVR_ILI9341::setScrollMargins(uint16_t top, uint16_t bottom) {
   // TFA+VSA+BFA must equal 320
   if (top + bottom <= TFT_HEIGHT) {
     uint16_t middle = TFT_HEIGHT - (top + bottom);
+    _scrollTop = top;
+    _scrollHeight = middle;
     uint8_t data[6];
     data[0] = top >> 8;
     data[1] = top & 0xff;
@@ -162,6 +407,234 @@ void AVR_ILI9341::setScrollMargins(uint16_t top, uint16_t bottom) {
   }
 }
 
+/*!
+    @brief   Returns the axis hardware scrolling moves the content along at
+             the current rotation. The display only scrolls along its native
+             320-line axis, which is the x axis in landscape.
+    @return  ScrollAxisY at rotations 0 and 2, ScrollAxisX at 1 and 3.
+*/
+scrollAxis AVR_ILI9341::getScrollAxis(void) const {
+  return (rotation & 1) ? ScrollAxisX : ScrollAxisY;
+}
+
+/*!
+    @brief   Sets the part of the display that scrolls, in coordinates of the
+             current rotation along getScrollAxis(): a band of rows in
+             portrait, of columns in landscape. The rest stays fixed.
+    @param   start  First row (portrait) or column (landscape) scrolled.
+    @param   length  Rows or columns scrolled, start + length must not
+                     exceed 320.
+*/
+void AVR_ILI9341::setScrollArea(uint16_t start, uint16_t length) {
+  if (length == 0 || start + length > TFT_HEIGHT) return;
+
+  // At rotations 2 and 3 the axis runs against the memory lines.
+  if (rotation >= 2) start = TFT_HEIGHT - start - length;
+  setScrollMargins(start, TFT_HEIGHT - start - length);
+}
+
+/*!
+    @brief   Scrolls the scroll area so that it shows its content moved
+             towards its start by `offset`, the lines moved out coming back
+             in at its end: upwards in portrait and as a right to left
+             marquee in landscape, whatever the rotation.
+    @param   offset  Rows or columns the content is moved by. Scrolling back
+                     to 0 shows the content where it was drawn.
+    @note    To scroll along the other axis see moveRect().
+*/
+void AVR_ILI9341::scrollArea(uint16_t offset) {
+  if (_scrollHeight == 0) return;
+
+  offset %= _scrollHeight;
+  if (rotation >= 2 && offset > 0) offset = _scrollHeight - offset;
+  scrollTo(_scrollTop + offset);
+}
+
+#if TFT_ENABLE_IMAGES
+/*!
+    @brief   Draws a '565' RGB image stored in RAM, row by row from its
+             top-left corner. Images not fully on the display are skipped.
+    @param   x  Display column of the image's top-left corner.
+    @param   y  Display row of the image's top-left corner.
+    @param   w  Image width in pixels.
+    @param   h  Image height in pixels.
+    @param   img  The w * h pixels of the image.
+*/
+void AVR_ILI9341::drawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            const uint16_t *img) {
+  TFT_PROFILE(TFT_PROF_DRAW_IMAGE);
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+  setAddressWindow(x, y, x + w - 1, y + h - 1);
+  writeImage(img, (uint32_t)w * h);
+  SPI_END();
+}
+
+/*!
+    @brief   Draws an image stored in the display's byte order, '565' RGB
+             with the most significant byte first, as written by
+             extras/image_header.py. The bytes go out exactly as stored.
+    @param   x  Display column of the image's top-left corner.
+    @param   y  Display row of the image's top-left corner.
+    @param   w  Image width in pixels.
+    @param   h  Image height in pixels.
+    @param   img  The 2 * w * h bytes of the image, in RAM.
+*/
+void AVR_ILI9341::drawPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                             const uint8_t *img) {
+  TFT_PROFILE(TFT_PROF_DRAW_IMAGE);
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+  setAddressWindow(x, y, x + w - 1, y + h - 1);
+  writePixels(img, (uint32_t)w * h);
+  SPI_END();
+}
+
+/*!
+    @brief   Same as drawPixels() for an image in PROGMEM.
+    @param   x  Display column of the image's top-left corner.
+    @param   y  Display row of the image's top-left corner.
+    @param   w  Image width in pixels.
+    @param   h  Image height in pixels.
+    @param   img  The 2 * w * h bytes of the image, in PROGMEM.
+*/
+void AVR_ILI9341::drawPixels_P(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                               const uint8_t *img) {
+  TFT_PROFILE(TFT_PROF_DRAW_IMAGE);
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+  setAddressWindow(x, y, x + w - 1, y + h - 1);
+  writePixels_P(img, (uint32_t)w * h);
+  SPI_END();
+}
+
+/*!
+    @brief   Fills a rectangle with a translucent color over a background
+             of one known color. The blend is computed once, nothing is read
+             back from the display.
+    @param   x  Display column of the rectangle's top-left corner.
+    @param   y  Display row of the rectangle's top-left corner.
+    @param   w  Rectangle width in pixels.
+    @param   h  Rectangle height in pixels.
+    @param   color  Fill color.
+    @param   alpha  Opacity of the fill, 0-255.
+    @param   bg  Color under the rectangle.
+*/
+void AVR_ILI9341::fillRectAlpha(uint16_t x, uint16_t y, uint16_t w,
+                                uint16_t h, uint16_t color, uint8_t alpha,
+                                uint16_t bg) {
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+  setAddressWindow(x, y, x + w - 1, y + h - 1);
+  writeData16(TFT_Color::alphaBlend(color, bg, TFT_Color::alpha5(alpha)),
+              (uint32_t)w * h);
+  SPI_END();
+}
+
+/*!
+    @brief   Draws a translucent '565' RGB image over a background of one
+             known color, in a single address window.
+    @param   x  Display column of the image's top-left corner.
+    @param   y  Display row of the image's top-left corner.
+    @param   w  Image width in pixels.
+    @param   h  Image height in pixels.
+    @param   img  The w * h pixels of the image.
+    @param   alpha  Opacity of the image, 0-255.
+    @param   bg  Color under the image.
+*/
+void AVR_ILI9341::drawImageAlpha(uint16_t x, uint16_t y, uint16_t w,
+                                 uint16_t h, const uint16_t *img,
+                                 uint8_t alpha, uint16_t bg) {
+  blendRect(x, y, w, h, img, NULL, 0, alpha, &bg);
+}
+
+/*!
+    @brief   Draws a color through an 8-bit coverage mask over a background
+             of one known color, e.g. an anti-aliased glyph.
+    @param   x  Display column of the mask's top-left corner.
+    @param   y  Display row of the mask's top-left corner.
+    @param   w  Mask width in pixels.
+    @param   h  Mask height in pixels.
+    @param   mask  The w * h coverages, 0 shows bg and 255 shows color.
+    @param   color  Color drawn.
+    @param   bg  Color under the mask.
+*/
+void AVR_ILI9341::drawMask(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           const uint8_t *mask, uint16_t color, uint16_t bg) {
+  blendRect(x, y, w, h, NULL, mask, color, 0, &bg);
+}
+
+/*!
+    @brief   Composites a color, an image or a masked color over a rectangle,
+             TFT_BLEND_CHUNK pixels at a time. The background is either the
+             known color bg, the whole rectangle being written in one
+             address window, or the display's pixels read back one row span
+             at a time.
+    @param   x  Display column of the rectangle's top-left corner.
+    @param   y  Display row of the rectangle's top-left corner.
+    @param   w  Rectangle width in pixels.
+    @param   h  Rectangle height in pixels.
+    @param   img  w * h foreground pixels, or NULL to use color.
+    @param   mask  w * h opacities 0-255, or NULL to use alpha.
+    @param   color  Foreground color without img.
+    @param   alpha  Opacity without mask, 0-255.
+    @param   bg  Background color, or NULL to read the display back.
+*/
+void AVR_ILI9341::blendRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            const uint16_t *img, const uint8_t *mask,
+                            uint16_t color, uint8_t alpha,
+                            const uint16_t *bg) {
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+#if !TFT_ENABLE_READBACK
+  if (bg == NULL) return;
+#endif
+
+  uint16_t buf[TFT_BLEND_CHUNK];
+  uint8_t a = TFT_Color::alpha5(alpha);
+  uint32_t total = (uint32_t)w * h;
+  uint16_t col = 0, row = 0;  // Position of the chunk read back.
+
+  if (bg != NULL) setAddressWindow(x, y, x + w - 1, y + h - 1);
+
+  for (uint32_t at = 0; at < total;) {
+    uint16_t n = TFT_BLEND_CHUNK;
+    if (bg != NULL) {
+      if (total - at < n) n = total - at;
+      for (uint16_t i = 0; i < n; i++) buf[i] = *bg;
+    } else {
+      if (w - col < n) n = w - col;
+#if TFT_ENABLE_READBACK
+      readPixels(x + col, y + row, n, 1, buf);
+#endif
+    }
+
+    if (img == NULL && mask == NULL) {
+      TFT_Color::blendSpan(buf, color, a, n);
+    } else {
+      for (uint16_t i = 0; i < n; i++) {
+        uint16_t fg = img ? img[at + i] : color;
+        uint8_t ai = mask ? TFT_Color::alpha5(mask[at + i]) : a;
+        buf[i] = TFT_Color::alphaBlend(fg, buf[i], ai);
+      }
+    }
+
+    if (bg != NULL) {
+      writeImage(buf, n);
+    } else {
+      drawImage(x + col, y + row, n, 1, buf);
+      col += n;
+      if (col == w) {
+        col = 0;
+        row++;
+      }
+    }
+    at += n;
+  }
+
+  if (bg != NULL) SPI_END();
+}
+#endif
+
 /*!
     @brief   Sets the "address window" - the rectangle we will write to RAM with
               the next chunk of SPI data writes. The ILI9341 will automatically
@@ -171,12 +644,43 @@ void AVR_ILI9341::setScrollMargins(uint16_t top, uint16_t bottom) {
     @param   x2  TFT memory 'x' axis end point. Also display's End Column (EC)
     @param   y2  TFT memory 'y' axis end point. Also display's End Page (EP)
 
-    @note    The caller should close the SPI bus via SPI_END() command call.
+    @note    The caller should close the SPI bus via endWrite() once the
+             pixels are written.
+    @note    Until then at most the window's area of pixels is written, see
+             TFT_SPI::windowErrors().
 */
 void AVR_ILI9341::setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2,
                                    uint16_t y2) {
+  TFT_PROFILE(TFT_PROF_ADDRESS_WINDOW);
   SPI_START();
+  setWindow(x1, y1, x2, y2);
+  writeCommand(ILI9341_RAMWR);  // Data memory write command.
+  setPixelBudget(x1, y1, x2, y2);
+}
 
+/*!
+    @brief   Resumes the memory write of the current address window after an
+             endWrite(), e.g. once another device on the bus has been read.
+             The next pixel written follows the last one written.
+    @note    The caller should close the SPI bus via endWrite() again.
+*/
+void AVR_ILI9341::continueWrite(void) {
+  uint32_t left = _pixelsLeft;  // The window's budget survives the break.
+  SPI_START();
+  writeCommand(ILI9341_RAMWRC);
+  _pixelsLeft = left;
+}
+
+/*!
+    @brief   Sends the column and page addresses of a window without starting
+             a memory read or write. The SPI bus must already be open.
+    @param   x1  Start Column (SC)
+    @param   y1  Start Page (SP)
+    @param   x2  End Column (EC)
+    @param   y2  End Page (EP)
+*/
+void AVR_ILI9341::setWindow(uint16_t x1, uint16_t y1, uint16_t x2,
+                            uint16_t y2) {
   writeCommand(ILI9341_CASET);  // Column address set
   writeData16(x1, 1);
   writeData16(x2, 1);
@@ -184,10 +688,9 @@ void AVR_ILI9341::setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2,
   writeCommand(ILI9341_PASET);  // Row address set
   writeData16(y1, 1);
   writeData16(y2, 1);
-
-  writeCommand(ILI9341_RAMWR);  // Data memory write command.
 }
 
+#if TFT_ENABLE_READBACK
 /*!
     @brief  Reads 8 bits of data from ILI9341 configuration memory.
             NOT from RAM! This is highly undocumented/supported, it's
@@ -197,7 +700,7 @@ void AVR_ILI9341::setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2,
     @return   Unsigned 8-bit data read from ILI9341 register
  */
 uint8_t AVR_ILI9341::readcommand(uint8_t commandByte, uint8_t index) {
-  SPI_START();
+  SPI_START_READ();
 
   uint8_t data = 0x10 + index;
   sendCommand(0xD9, &data, 1);  // Set Index Register
@@ -206,3 +709,315 @@ uint8_t AVR_ILI9341::readcommand(uint8_t commandByte, uint8_t index) {
   SPI_END();
   return result;
 }
+
+/*!
+    @brief  Reads a rectangle of pixels back from the display memory (RAM)
+            row by row. Rectangles not fully on the display are skipped.
+    @param  x  Display column of the rectangle's top-left corner.
+    @param  y  Display row of the rectangle's top-left corner.
+    @param  w  Rectangle width in pixels.
+    @param  h  Rectangle height in pixels.
+    @param  pixels  Receives the w * h pixels in '565' RGB format.
+    @note   The display returns 18-bit pixels (three bytes, 6 bits per color)
+            whatever the interface pixel format, they are packed back to 565.
+    @note   The transaction runs at the read clock, TFT_READ_FREQ.
+*/
+void AVR_ILI9341::readPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                             uint16_t *pixels) {
+  TFT_PROFILE(TFT_PROF_READ_PIXELS);
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+  SPI_START_READ();
+  setWindow(x, y, x + w - 1, y + h - 1);
+  writeCommand(ILI9341_RAMRD);  // Data memory read command.
+  DC_HIGH();
+  readData();  // Discard the dummy read.
+
+  for (uint32_t num = (uint32_t)w * h; num > 0; num--) {
+    uint8_t r = readData();
+    uint8_t g = readData();
+    uint8_t b = readData();
+    *pixels++ = TFT_Color::rgb565(r, g, b);
+  }
+
+  SPI_END();
+}
+#endif
+
+#if TFT_ENABLE_READBACK && TFT_ENABLE_IMAGES
+/*!
+    @brief  Moves the content of a rectangle by (dx, dy) within it, reading
+            it back from the display memory TFT_MOVE_CHUNK pixels at a time.
+            This is the software scrolling for the axis the display cannot
+            scroll along, or for scrolling a rectangle smaller than the
+            display. Rectangles not fully on the display are skipped.
+    @param  x  Display column of the rectangle's top-left corner.
+    @param  y  Display row of the rectangle's top-left corner.
+    @param  w  Rectangle width in pixels.
+    @param  h  Rectangle height in pixels.
+    @param  dx  Columns moved by, negative to move left.
+    @param  dy  Rows moved by, negative to move up.
+    @note   Content moved out of the rectangle is dropped and the uncovered
+            part keeps its old pixels for the caller to draw over.
+*/
+void AVR_ILI9341::moveRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           int16_t dx, int16_t dy) {
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+  uint16_t adx = dx < 0 ? -dx : dx;
+  uint16_t ady = dy < 0 ? -dy : dy;
+  if (adx >= w || ady >= h) return;  // Everything moves out.
+
+  uint16_t cols = w - adx;
+  uint16_t rows = h - ady;
+  uint16_t srcX = dx < 0 ? x + adx : x;
+  uint16_t srcY = dy < 0 ? y + ady : y;
+  uint16_t dstX = dx < 0 ? x : x + adx;
+  uint16_t dstY = dy < 0 ? y : y + ady;
+
+  uint16_t buf[TFT_MOVE_CHUNK];
+
+  // Copy away from the side moved towards, so that no pixel is overwritten
+  // before it has been read.
+  for (uint16_t i = 0; i < rows; i++) {
+    uint16_t row = dy > 0 ? rows - 1 - i : i;
+
+    for (uint16_t j = 0; j < cols;) {
+      uint16_t n = cols - j < TFT_MOVE_CHUNK ? cols - j : TFT_MOVE_CHUNK;
+      uint16_t col = dx > 0 ? cols - j - n : j;
+
+      readPixels(srcX + col, srcY + row, n, 1, buf);
+      drawImage(dstX + col, dstY + row, n, 1, buf);
+      j += n;
+    }
+  }
+}
+
+/*!
+    @brief  Fills a rectangle with a translucent color over what the display
+            shows, e.g. to dim the screen behind a dialog. The pixels are
+            read back TFT_BLEND_CHUNK at a time and blended as a whole span.
+    @param  x  Display column of the rectangle's top-left corner.
+    @param  y  Display row of the rectangle's top-left corner.
+    @param  w  Rectangle width in pixels.
+    @param  h  Rectangle height in pixels.
+    @param  color  Fill color.
+    @param  alpha  Opacity of the fill, 0-255.
+*/
+void AVR_ILI9341::fillRectAlpha(uint16_t x, uint16_t y, uint16_t w,
+                                uint16_t h, uint16_t color, uint8_t alpha) {
+  blendRect(x, y, w, h, NULL, NULL, color, alpha, NULL);
+}
+
+/*!
+    @brief  Draws a translucent '565' RGB image over what the display shows.
+    @param  x  Display column of the image's top-left corner.
+    @param  y  Display row of the image's top-left corner.
+    @param  w  Image width in pixels.
+    @param  h  Image height in pixels.
+    @param  img  The w * h pixels of the image.
+    @param  alpha  Opacity of the image, 0-255.
+*/
+void AVR_ILI9341::drawImageAlpha(uint16_t x, uint16_t y, uint16_t w,
+                                 uint16_t h, const uint16_t *img,
+                                 uint8_t alpha) {
+  blendRect(x, y, w, h, img, NULL, 0, alpha, NULL);
+}
+
+/*!
+    @brief  Draws a color through an 8-bit coverage mask over what the
+            display shows, e.g. an anti-aliased glyph on an image.
+    @param  x  Display column of the mask's top-left corner.
+    @param  y  Display row of the mask's top-left corner.
+    @param  w  Mask width in pixels.
+    @param  h  Mask height in pixels.
+    @param  mask  The w * h coverages, 0 keeps the pixel and 255 shows color.
+    @param  color  Color drawn.
+*/
+void AVR_ILI9341::drawMask(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           const uint8_t *mask, uint16_t color) {
+  blendRect(x, y, w, h, NULL, mask, color, 0, NULL);
+}
+
+/*!
+    @brief  Darkens a rectangle of what the display shows, e.g. behind a
+            dialog, without repainting it. The rectangle is read back in
+            strips of up to TFT_BLEND_CHUNK pixels at the read clock, each
+            channel is shifted right and the strip is written back at the
+            write clock.
+    @param  x  Display column of the rectangle's top-left corner.
+    @param  y  Display row of the rectangle's top-left corner.
+    @param  w  Rectangle width in pixels.
+    @param  h  Rectangle height in pixels.
+    @param  level  Right shifts of each channel: 1 halves the brightness, 2
+                   quarters it, 6 and above give black.
+*/
+void AVR_ILI9341::dimRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                          uint8_t level) {
+  if (w == 0 || h == 0 || x + w > _width || y + h > _height || level == 0)
+    return;
+
+  // Strips of whole rows when they fit in the buffer, else row chunks.
+  uint16_t cols = w < TFT_BLEND_CHUNK ? w : TFT_BLEND_CHUNK;
+  uint16_t rows = TFT_BLEND_CHUNK / cols;
+  uint16_t buf[TFT_BLEND_CHUNK];
+
+  for (uint16_t row = 0; row < h; row += rows) {
+    uint16_t n = h - row < rows ? h - row : rows;
+
+    for (uint16_t col = 0; col < w; col += cols) {
+      uint16_t m = w - col < cols ? w - col : cols;
+
+      readPixels(x + col, y + row, m, n, buf);
+      TFT_Color::dimSpan(buf, level, m * n);
+      drawImage(x + col, y + row, m, n, buf);
+    }
+  }
+}
+
+/*!
+    @brief  Finds the highest write clock the wiring carries reliably. From
+            maxFreq down, each clock writes test patterns over the top
+            TFT_TUNE_ROWS rows and reads them back at the read clock; the
+            first clock getting every pixel back is kept. Call it after
+            begin() and clear the screen afterwards.
+    @param  maxFreq  First clock tried, in Hz. Each next one is 3/4 of it,
+                     down to 1 MHz. On AVR, where the SPI clock can only be
+                     F_CPU / 2^n, it starts at F_CPU / 2 at most and halves,
+                     so each divider is tried once.
+    @return The write clock kept, or 0 if none passed (e.g. MISO is not
+            wired), the write clock is unchanged then.
+*/
+uint32_t AVR_ILI9341::tuneClock(uint32_t maxFreq) {
+  uint32_t old = writeClock();
+
+#if defined(__AVR__)
+  if (maxFreq > F_CPU / 2) maxFreq = F_CPU / 2;  // The fastest divider.
+#endif
+
+  uint32_t freq = maxFreq;
+  while (freq >= 1000000UL) {
+    setWriteClock(freq);
+
+    if (checkClock()) return freq;
+#if defined(__AVR__)
+    freq /= 2;  // SPISettings would round 3/4 down to the same divider.
+#else
+    freq -= freq / 4;
+#endif
+  }
+
+  setWriteClock(old);
+  return 0;
+}
+
+/*!
+    @brief  Picks the write clock at begin(). A clock cached in EEPROM by an
+            earlier boot is kept if it still passes checkClock(), otherwise
+            tuneClock() searches again and the clock found is cached.
+            Without TFT_TUNE_EEPROM every boot searches.
+    @param  maxFreq  Highest clock used, in Hz.
+*/
+void AVR_ILI9341::autoTune(uint32_t maxFreq) {
+#if TFT_TUNE_EEPROM
+  uint32_t old = writeClock();
+  uint32_t cached, check;
+  EEPROM.get(TFT_TUNE_EEPROM_ADDR, cached);
+  EEPROM.get(TFT_TUNE_EEPROM_ADDR + 4, check);
+
+  // The CRC rejects erased (0xFF) and foreign records.
+  if (check == crc32(crc32(0, cached >> 16), cached) && cached <= maxFreq &&
+      cached >= 1000000UL) {
+    setWriteClock(cached);
+    if (checkClock()) return;
+    setWriteClock(old);
+  }
+
+  // EEPROM.put() only rewrites the bytes that changed.
+  uint32_t freq = tuneClock(maxFreq);
+  if (freq) {
+    EEPROM.put(TFT_TUNE_EEPROM_ADDR, freq);
+    EEPROM.put(TFT_TUNE_EEPROM_ADDR + 4, crc32(crc32(0, freq >> 16), freq));
+  }
+#else
+  tuneClock(maxFreq);
+#endif
+}
+
+/*!
+    @brief  Checks the link at the current write clock with every test
+            pattern.
+    @return true if all of them read back intact.
+*/
+bool AVR_ILI9341::checkClock(void) {
+  for (uint8_t pass = 0; pass < 3; pass++) {
+    if (!tunePass(pass)) return false;
+  }
+  return true;
+}
+
+/*!
+    @brief  Writes a test pattern at the write clock, reads it back and
+            compares the CRC-32 of both streams.
+    @param  pass  Pattern, see tunePixel().
+    @return true if the CRCs match.
+*/
+bool AVR_ILI9341::tunePass(uint8_t pass) {
+  uint32_t sent = 0, got = 0;
+
+  setAddressWindow(0, 0, _width - 1, TFT_TUNE_ROWS - 1);
+  for (uint16_t i = 0; i < _width * TFT_TUNE_ROWS; i++) {
+    uint16_t color = tunePixel(pass, i);
+    sent = crc32(sent, color);
+    writeData16(color, 1);
+  }
+  endWrite();
+
+  uint16_t buf[TFT_BLEND_CHUNK];
+  for (uint16_t row = 0; row < TFT_TUNE_ROWS; row++) {
+    for (uint16_t col = 0; col < _width; col += TFT_BLEND_CHUNK) {
+      uint16_t n = _width - col < TFT_BLEND_CHUNK ? _width - col
+                                                  : TFT_BLEND_CHUNK;
+      readPixels(col, row, n, 1, buf);
+      for (uint16_t i = 0; i < n; i++) got = crc32(got, buf[i]);
+    }
+  }
+  return got == sent;
+}
+
+/*!
+    @brief  Adds a 16-bit word, high byte first, to a standard (zlib)
+            CRC-32, computed bit by bit.
+    @param  crc  CRC of the words so far, 0 to start.
+    @param  data  Next word.
+    @return The updated CRC.
+*/
+uint32_t AVR_ILI9341::crc32(uint32_t crc, uint16_t data) {
+  crc = ~crc;
+  for (uint8_t byte = 0; byte < 2; byte++) {
+    crc ^= byte ? data & 0xFF : data >> 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+/*!
+    @brief  Returns a pixel of a tuneClock() test pattern.
+    @param  pass  0: alternating 0x5555 and 0xAAAA, every bit toggling. 1:
+                  alternating black and white. 2: pseudo-random pixels.
+    @param  i  Pixel index in the pattern.
+    @return The pixel.
+*/
+uint16_t AVR_ILI9341::tunePixel(uint8_t pass, uint16_t i) {
+  switch (pass) {
+    case 0:
+      return i & 1 ? 0xAAAA : 0x5555;
+    case 1:
+      return i & 1 ? 0xFFFF : 0x0000;
+    default:
+      return i * 0x9E37U + 0x79B9U;
+  }
+}
+#endif
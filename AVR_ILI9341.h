@@ -25,6 +25,48 @@
 #include <SPI.h>
 
 #include "utility/TFT_SPI.h"
+#include "utility/TFT_Assets.h"
+#include "utility/TFT_Backlight.h"
+#include "utility/TFT_Color.h"
+#include "utility/TFT_Fast.h"
+#include "utility/TFT_Health.h"
+#include "utility/TFT_Hit.h"
+#include "utility/TFT_Profile.h"
+#include "utility/TFT_SRAM.h"
+#include "utility/TFT_Slide.h"
+#include "utility/TFT_Touch.h"
+#include "utility/TFT_Trace.h"
+#include "utility/TFT_Wall.h"
+
+#ifndef TFT_MOVE_CHUNK
+#define TFT_MOVE_CHUNK 32  ///< Pixels buffered on the stack by moveRect().
+#endif
+
+#ifndef TFT_TUNE_MAX_FREQ
+#if defined(ARDUINO_ARCH_AVR)
+#define TFT_TUNE_MAX_FREQ 8000000L  ///< First write clock tried, F_CPU / 2.
+#else
+#define TFT_TUNE_MAX_FREQ 80000000L  ///< First write clock tried.
+#endif
+#endif
+
+#define TFT_TUNE_ROWS 2  ///< Rows of test patterns written by tuneClock().
+
+#ifndef TFT_TUNE_EEPROM
+#if defined(ARDUINO_ARCH_AVR)
+#define TFT_TUNE_EEPROM 1  ///< begin() caches the tuned clock in EEPROM.
+#else
+#define TFT_TUNE_EEPROM 0  ///< EEPROM emulations differ, tune every boot.
+#endif
+#endif
+
+#ifndef TFT_TUNE_EEPROM_ADDR
+#define TFT_TUNE_EEPROM_ADDR (E2END - 7)  ///< Cache record, last 8 bytes.
+#endif
+
+#ifndef TFT_BLEND_CHUNK
+#define TFT_BLEND_CHUNK 32  ///< Pixels buffered on the stack by the blends.
+#endif
 
 #define ILI9341_NOP 0x00      ///< No-op register
 #define ILI9341_SWRESET 0x01  ///< Software reset register
@@ -58,6 +100,12 @@
 #define ILI9341_MADCTL 0x36    ///< Memory Access Control
 #define ILI9341_VSCRSADD 0x37  ///< Vertical Scrolling Start Address
 #define ILI9341_PIXFMT 0x3A    ///< COLMOD: Pixel Format Set
+#define ILI9341_RAMWRC 0x3C    ///< Write Memory Continue
+
+#define ILI9341_WRDISBV 0x51   ///< Write Display Brightness
+#define ILI9341_WRCTRLD 0x53   ///< Write CTRL Display
+#define ILI9341_WRCABC 0x55    ///< Write Content Adaptive Brightness Control
+#define ILI9341_WRCABCMB 0x5E  ///< Write CABC Minimum Brightness
 
 #define ILI9341_FRMCTR1 \
   0xB1  ///< Frame Rate Control (In Normal Mode/Full Colors)
@@ -92,6 +140,8 @@
 
 #define ILI9341_GMCTRP1 0xE0  ///< Positive Gamma Correction
 #define ILI9341_GMCTRN1 0xE1  ///< Negative Gamma Correction
+#define ILI9341_DGMCTR1 0xE2  ///< Digital Gamma Control 1
+#define ILI9341_DGMCTR2 0xE3  ///< Digital Gamma Control 2
 #define ILI9341_TIMCTRA 0xE8  ///< Driver timing control A
 #define ILI9341_TIMCTRB 0xE9  ///< Driver timing control B
 #define ILI9341_TIMCTRC 0xEA  ///< Driver timing control C
@@ -105,6 +155,9 @@
 #define CMD_DELAY 0x78  ///< 120ms
 // #define ILI9341_PWCTR6     0xFC
 
+#define CTRLD_BCTRL 0x20  ///< Brightness Control Block on
+#define CTRLD_BL 0x04     ///< Backlight Control on
+
 #define MADCTL_MY 0x80   ///< Bottom to top
 #define MADCTL_MX 0x40   ///< Right to left
 #define MADCTL_MV 0x20   ///< Reverse Mode
@@ -134,6 +187,27 @@
 #define ILI9341_GREENYELLOW 0xAFE5  ///< 173, 255,  41
 #define ILI9341_PINK 0xFC18         ///< 255, 130, 198
 
+/*!
+  @brief  Axis of the current rotation along which hardware scrolling moves
+          the display content.
+*/
+enum scrollAxis {
+  ScrollAxisY,  ///< Portrait rotations, the content moves up or down.
+  ScrollAxisX   ///< Landscape rotations, the content moves left or right.
+};
+
+/*!
+  @brief  Content adaptive brightness control (CABC) modes: the display
+          lowers its LEDPWM duty cycle for dark content and raises the
+          pixel values to make up for it.
+*/
+enum cabcMode {
+  CabcOff,      ///< The duty cycle is the one of setBrightness().
+  CabcUI,       ///< User interface, keeps the picture most faithful.
+  CabcStill,    ///< Still pictures, saves more.
+  CabcMoving    ///< Moving images, saves the most.
+};
+
 /*!
   @brief Class to manage hardware interface with ILI9341 chipset
         (also seems to work with ILI9340)
@@ -144,15 +218,85 @@ class AVR_ILI9341 : public TFT_SPI {
 
   virtual ~AVR_ILI9341(){};
 
-  void begin(uint32_t freq = 0);
+  void begin(uint32_t freq = 0, bool tune = false);
+  void reinit(void);
+  bool loadTable(const uint8_t *table);
+  bool loadTable_P(const uint8_t *table);
+  void setBrightness(uint8_t level);
+  void setCABC(cabcMode mode, uint8_t minBrightness = 0);
+  void setCABCThreshold(uint8_t ui, uint8_t still, uint8_t moving);
+  void setCABCMinGray(uint8_t ui, uint8_t still, uint8_t moving);
   void setRotation(uint8_t r);
   void scrollTo(uint16_t y);
   void setScrollMargins(uint16_t top, uint16_t bottom);
+  scrollAxis getScrollAxis(void) const;
+  void setScrollArea(uint16_t start, uint16_t length);
+  void scrollArea(uint16_t offset);
+#if TFT_ENABLE_IMAGES
+  void drawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 const uint16_t *img);
+  void drawPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                  const uint8_t *img);
+  void drawPixels_P(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    const uint8_t *img);
+  void fillRectAlpha(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint16_t color, uint8_t alpha, uint16_t bg);
+  void drawImageAlpha(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      const uint16_t *img, uint8_t alpha, uint16_t bg);
+  void drawMask(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                const uint8_t *mask, uint16_t color, uint16_t bg);
+#endif
+#if TFT_ENABLE_READBACK
   uint8_t readcommand(uint8_t reg, uint8_t index = 0);
+  void readPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                  uint16_t *pixels);
+#endif
+#if TFT_ENABLE_READBACK && TFT_ENABLE_IMAGES
+  void moveRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, int16_t dx,
+                int16_t dy);
+  void fillRectAlpha(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint16_t color, uint8_t alpha);
+  void drawImageAlpha(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      const uint16_t *img, uint8_t alpha);
+  void drawMask(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                const uint8_t *mask, uint16_t color);
+  void dimRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t level);
+  uint32_t tuneClock(uint32_t maxFreq = TFT_TUNE_MAX_FREQ);
+#endif
 
- private:
-  // Transaction API not used by GFX
+  // Transaction API
   void setAddressWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void continueWrite(void);
+
+ private:
+  void sendInitScript(void);
+  bool sendTable(const uint8_t *table, bool progmem);
+  static uint8_t tableArgs(uint8_t cmd);
+  void sendCABC(void);
+  void setWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+#if TFT_ENABLE_READBACK && TFT_ENABLE_IMAGES
+  void autoTune(uint32_t maxFreq);
+  bool checkClock(void);
+  bool tunePass(uint8_t pass);
+  static uint32_t crc32(uint32_t crc, uint16_t data);
+  static uint16_t tunePixel(uint8_t pass, uint16_t i);
+#endif
+#if TFT_ENABLE_IMAGES
+  void blendRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 const uint16_t *img, const uint8_t *mask, uint16_t color,
+                 uint8_t alpha, const uint16_t *bg);
+#endif
+
+  uint16_t _scrollTop;     ///< Top fixed area (TFA) in memory lines.
+  uint16_t _scrollHeight;  ///< Vertical scrolling area (VSA) in memory lines.
+  const uint8_t *_table;   ///< Last table loaded, sent again by reinit().
+  bool _tableP;            ///< _table is in PROGMEM.
+  uint8_t _ctrld;          ///< WRCTRLD, 0 until setBrightness().
+  uint8_t _brightness;     ///< WRDISBV, the panel's LEDPWM duty.
+  uint8_t _cabc;           ///< WRCABC, a cabcMode.
+  uint8_t _cabcMin;        ///< WRCABCMB, the lowest duty CABC sets.
+  uint8_t _bckctr[4];      ///< BCKCTR1-4, the CABC thresholds.
+  uint8_t _bckctrSet;      ///< Bit 0: BCKCTR1-2 set, bit 1: BCKCTR3-4.
 };
 
 #endif  // _AVR_ILI9341H_
\ No newline at end of file
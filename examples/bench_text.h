@@ -0,0 +1,85 @@
+/*!
+ * @file bench_text.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+
+// Adafruit_GFX text test shared by examples/benchmark.ino, which times it on a
+// board, and extras/host/benchmark.cpp, which counts its bytes on the host.
+
+#ifndef _BENCH_TEXT_H_
+#define _BENCH_TEXT_H_
+
+#include <Arduino.h>
+
+#include "utility/Adafruit_GFX.h"
+#include "utility/TFT_GFX.h"
+
+/*!
+  @brief  TextCanvas renders Adafruit_GFX text on a TFT_GFX display. Each
+          glyph pixel, or size x size block for larger text, is written as
+          its own address window.
+*/
+class TextCanvas : public Adafruit_GFX {
+ public:
+  TextCanvas(TFT_GFX &gfx)
+      : Adafruit_GFX(gfx.width(), gfx.height()), _gfx(gfx) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    fillRect(x, y, 1, 1, color);
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0 || y < 0 || w <= 0 || h <= 0) return;
+    if (x + w > _gfx.width() || y + h > _gfx.height()) return;
+
+    _gfx.setAddressWindow(x, y, x + w - 1, y + h - 1);
+    _gfx.writeData16(color, (uint32_t)w * h);
+    _gfx.endWrite();
+  }
+
+ private:
+  TFT_GFX &_gfx;  ///< Display the text is drawn on.
+};
+
+/*!
+  @brief  Prints the text of the benchmark, in three colors and two sizes.
+  @param  text  Canvas of the display, drawn from its top-left corner.
+*/
+static void printBenchText(TextCanvas &text) {
+  text.setCursor(0, 0);
+  text.setTextColor(0xFFFF);  // White.
+  text.setTextSize(2);
+  text.println("Hello World!");
+  text.println();
+  text.setTextColor(0xF800);  // Red.
+  text.println("Display Testing:");
+  text.println();
+  text.setTextColor(0x07E0);  // Green.
+  text.setTextSize(1);
+  text.println("The quick brown fox jumps over the lazy dog");
+  text.println();
+  text.println("THE QUICK BROWN FOX JUMPED OVER THE LAZY DOG'S BACK");
+  text.println();
+  text.println("1234567890");
+  text.println();
+  text.println(",@#$%^&*()_-'';][}{|`!?<>");
+}
+
+#endif  // end _BENCH_TEXT_H_
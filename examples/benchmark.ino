@@ -0,0 +1,233 @@
+
+#include <AVR_ILI9341.h>
+#include <SPI.h>
+
+// Build the library with TFT_ENABLE_STATS=1 (utility/TFT_Config.h or
+// -DTFT_ENABLE_STATS=1) so the bytes sent over SPI are counted.
+#if !TFT_ENABLE_STATS
+#error "benchmark.ino needs the library built with TFT_ENABLE_STATS=1"
+#endif
+
+// extras/host/benchmark.cpp runs the same tests on the host, counting pixels
+// and bytes instead of timing them.
+#if TFT_ENABLE_TEXT
+#include "bench_text.h"
+#endif
+
+// For the Adafruit shield, these are the default.
+// helps to write each wire colour
+#define TFT_DC 8   // green
+#define TFT_RST 9  // yellow
+#define TFT_CS 10  // orange
+
+#define BACKLIGHT 4  // black
+
+#define SPI_FREQ 8000000L  // Wire speed the efficiency is measured against.
+
+// Use hardware SPI and the above for CS,DC and RST pins
+AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+TFT_Fast<AVR_ILI9341> fast(tft);
+
+#if TFT_ENABLE_IMAGES
+#define IMAGE_SIDE 16
+uint16_t image[IMAGE_SIDE * IMAGE_SIDE];
+#endif
+
+#if TFT_ENABLE_TEXT
+TextCanvas text(tft);
+#endif
+
+unsigned long startTime;
+
+void setup() {
+  Serial.begin(19200);
+  delay(3000);
+
+  pinMode(BACKLIGHT, OUTPUT);
+  digitalWrite(BACKLIGHT, HIGH);
+
+  tft.begin(SPI_FREQ);
+  delay(1000);
+
+  // One CSV row per test, compare the output between library versions.
+  Serial.println(F("test,us,spi_bytes,bytes_per_us,wire_pct"));
+
+  benchFillScreen();
+  benchFastFillScreen();
+  benchHorizontalSpans();
+  benchVerticalSpans();
+  benchPixels();
+  benchRects();
+  benchRoundRects();
+#if TFT_ENABLE_IMAGES
+  benchImage();
+#endif
+#if TFT_ENABLE_TEXT
+  benchText();
+#endif
+  benchScroll();
+
+  Serial.println(F("done"));
+}
+
+void loop(void) {}
+
+void startTest() {
+  tft.resetSPIBytes();
+  startTime = micros();
+}
+
+// Prints the CSV columns following the test name. wire_pct is the share of
+// the SPI clock spent shifting bytes, 100% being back-to-back transfers.
+void printStats(unsigned long elapsed) {
+  uint32_t bytes = tft.spiBytes();
+  float bytesPerUs = elapsed ? (float)bytes / elapsed : 0;
+  float wireBytesPerUs = SPI_FREQ / 8000000.0;
+
+  Serial.print(',');
+  Serial.print(elapsed);
+  Serial.print(',');
+  Serial.print(bytes);
+  Serial.print(',');
+  Serial.print(bytesPerUs, 3);
+  Serial.print(',');
+  Serial.println(100.0 * bytesPerUs / wireBytesPerUs, 1);
+  delay(50);
+}
+
+void endTest(const __FlashStringHelper *name) {
+  unsigned long elapsed = micros() - startTime;
+  Serial.print(name);
+  printStats(elapsed);
+}
+
+void benchFillScreen() {
+  startTest();
+  tft.fillScreen(ILI9341_BLACK);
+  tft.fillScreen(ILI9341_RED);
+  tft.fillScreen(ILI9341_GREEN);
+  tft.fillScreen(ILI9341_BLUE);
+  tft.fillScreen(ILI9341_BLACK);
+  endTest(F("fill_screen"));
+}
+
+void benchFastFillScreen() {
+  startTest();
+  fast.fillScreen(ILI9341_BLACK);
+  fast.fillScreen(ILI9341_RED);
+  fast.fillScreen(ILI9341_GREEN);
+  fast.fillScreen(ILI9341_BLUE);
+  fast.fillScreen(ILI9341_BLACK);
+  endTest(F("fast_fill_screen"));
+}
+
+void benchHorizontalSpans() {
+  startTest();
+  for (uint16_t y = 0; y < 300; y += 3) {
+    tft.drawShape(10, y, 200, 0, 0, 0, 0, ILI9341_YELLOW);
+  }
+  endTest(F("h_spans"));
+
+  startTest();
+  for (uint16_t y = 0; y < 300; y += 3) {
+    fast.drawShape(10, y, 200, 0, 0, 0, 0, ILI9341_CYAN);
+  }
+  endTest(F("fast_h_spans"));
+}
+
+void benchVerticalSpans() {
+  startTest();
+  for (uint16_t x = 0; x < 230; x += 3) {
+    tft.drawShape(x, 10, 0, 280, 0, 0, 0, ILI9341_MAGENTA);
+  }
+  endTest(F("v_spans"));
+}
+
+void benchPixels() {
+  startTest();
+  for (uint16_t i = 0; i < 1000; i++) {
+    tft.drawShape((i * 7) % 230, (i * 13) % 310, 0, 0, 0, 0, 0, i);
+  }
+  endTest(F("pixels"));
+}
+
+void benchRects() {
+  tft.fillScreen(ILI9341_BLACK);
+  startTest();
+  for (uint16_t side = 10; side < 200; side += 10) {
+    tft.drawShape(20, 20, side, side, 0, 0, 0, side * 97);
+  }
+  endTest(F("rects"));
+
+  startTest();
+  for (uint16_t side = 10; side < 200; side += 10) {
+    tft.drawShape(20, 20, side, side, 0, 2, ILI9341_WHITE, side * 97);
+  }
+  endTest(F("rects_stroke_2"));
+}
+
+void benchRoundRects() {
+  static const uint8_t radii[] = {2, 5, 10, 20};
+  static const uint8_t strokes[] = {0, 1, 3};
+  char name[24];
+
+  for (uint8_t r = 0; r < sizeof(radii); r++) {
+    for (uint8_t s = 0; s < sizeof(strokes); s++) {
+      tft.fillScreen(ILI9341_BLACK);
+      startTest();
+      for (uint8_t i = 0; i < 10; i++) {
+        tft.drawShape(20 + i, 20 + i, 120, 80, radii[r], strokes[s],
+                      ILI9341_WHITE, ILI9341_NAVY);
+      }
+      unsigned long elapsed = micros() - startTime;
+
+      snprintf(name, sizeof(name), "round_rect_r%u_s%u", radii[r], strokes[s]);
+      Serial.print(name);
+      printStats(elapsed);
+
+      startTest();
+      for (uint8_t i = 0; i < 10; i++) {
+        fast.drawShape(20 + i, 20 + i, 120, 80, radii[r], strokes[s],
+                       ILI9341_WHITE, ILI9341_OLIVE);
+      }
+      elapsed = micros() - startTime;
+
+      snprintf(name, sizeof(name), "fast_round_rect_r%u_s%u", radii[r],
+               strokes[s]);
+      Serial.print(name);
+      printStats(elapsed);
+    }
+  }
+}
+
+#if TFT_ENABLE_IMAGES
+void benchImage() {
+  for (uint16_t i = 0; i < IMAGE_SIDE * IMAGE_SIDE; i++) image[i] = i * 31;
+
+  startTest();
+  for (uint16_t y = 0; y + IMAGE_SIDE <= 320; y += IMAGE_SIDE) {
+    for (uint16_t x = 0; x + IMAGE_SIDE <= 240; x += IMAGE_SIDE) {
+      tft.drawImage(x, y, IMAGE_SIDE, IMAGE_SIDE, image);
+    }
+  }
+  endTest(F("image_16x16"));
+}
+#endif
+
+#if TFT_ENABLE_TEXT
+void benchText() {
+  tft.fillScreen(ILI9341_BLACK);
+  startTest();
+  printBenchText(text);
+  endTest(F("text"));
+}
+#endif
+
+void benchScroll() {
+  tft.setScrollMargins(0, 0);
+  startTest();
+  for (uint16_t y = 0; y <= 320; y++) {
+    tft.scrollTo(y % 320);
+  }
+  endTest(F("scroll_320"));
+}
@@ -0,0 +1,39 @@
+#include <AVR_ILI9341.h>
+#include <SPI.h>
+
+// Draws the same shapes through TFT_GFX's virtual calls or, built with
+// -DDISPATCH_FAST=1, through TFT_Fast's direct ones. extras/size_report.py
+// builds it both ways to compare the flash of the two paths:
+//
+//   python3 extras/size_report.py examples/dispatch_size.ino
+//       --config virtual= --config fast=-DDISPATCH_FAST=1
+//
+// The time each path takes per span is measured by benchmark.ino.
+
+#ifndef DISPATCH_FAST
+#define DISPATCH_FAST 0
+#endif
+
+// For the Adafruit shield, these are the default.
+#define TFT_DC 8
+#define TFT_RST 9
+#define TFT_CS 10
+
+AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+#if DISPATCH_FAST
+TFT_Fast<AVR_ILI9341> draw(tft);
+#else
+TFT_GFX &draw = tft;
+#endif
+
+void setup() {
+  tft.begin();
+
+  draw.fillScreen(ILI9341_BLACK);
+  draw.drawShape(10, 10, 200, 0, 0, 0, 0, ILI9341_YELLOW);
+  draw.drawShape(10, 20, 0, 200, 0, 0, 0, ILI9341_CYAN);
+  draw.drawShape(20, 40, 120, 80, 0, 2, ILI9341_WHITE, ILI9341_NAVY);
+  draw.drawShape(20, 140, 120, 80, 10, 2, ILI9341_WHITE, ILI9341_OLIVE);
+}
+
+void loop(void) {}
@@ -0,0 +1,50 @@
+
+#include <AVR_ILI9341.h>
+#include <SPI.h>
+
+// For the Adafruit shield, these are the default.
+#define TFT_DC 8
+#define TFT_RST 9
+#define TFT_CS 10
+
+#define BACKLIGHT 4
+
+// Use hardware SPI and the above for CS,DC and RST pins
+AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+TFT_Slide<AVR_ILI9341> slide(tft);
+
+// Page background colors, one page per slide.
+const uint16_t pages[] = {ILI9341_NAVY, ILI9341_DARKGREEN, ILI9341_MAROON,
+                          ILI9341_PURPLE};
+uint8_t page = 0;
+
+// Draws rows y to y + h - 1 of the current page: its background with a
+// white band every 40 rows to make the motion visible.
+void drawStrip(uint16_t y, uint16_t h) {
+  for (uint16_t row = y; row < y + h; row++) {
+    uint16_t color = (row % 40 < 4) ? ILI9341_WHITE : pages[page];
+    tft.drawShape(0, row, 240, 1, 0, 0, color, color);
+  }
+}
+
+void setup() {
+  pinMode(BACKLIGHT, OUTPUT);
+  digitalWrite(BACKLIGHT, HIGH);
+
+  tft.begin(8000000);
+  tft.setRotation(0);
+  drawStrip(0, TFT_HEIGHT);
+}
+
+void loop(void) {
+  delay(1000);
+
+  page = (page + 1) % (sizeof(pages) / sizeof(pages[0]));
+  slide.start(page % 2 ? TFT_Slide<AVR_ILI9341>::Up
+                       : TFT_Slide<AVR_ILI9341>::Down,
+              drawStrip);
+
+  while (slide.service()) {
+    // Free for other work between the steps.
+  }
+}
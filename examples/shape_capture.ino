@@ -0,0 +1,114 @@
+
+#include <AVR_ILI9341.h>
+#include <SPI.h>
+
+#include "shape_cases.h"
+
+// Draws edge-case and seeded random drawShape() calls one at a time, reads
+// each resulting frame back from the display and prints its CRC32 as CSV.
+// Compare the output with extras/golden_compare.py against the reference
+// in extras/host/shape_golden.txt.xz, which extras/host/shape_golden.cpp
+// computes on the host from the same cases, in shape_cases.h. Set DUMP_CASE
+// to a case number to also print that frame, for a per-pixel diff image
+// against the reference frame.
+
+// For the Adafruit shield, these are the default.
+// helps to write each wire colour
+#define TFT_DC 8   // green
+#define TFT_RST 9  // yellow
+#define TFT_CS 10  // orange
+
+#define BACKLIGHT 4  // black
+
+#define DUMP_CASE -1  // Case whose frame is printed, -1 for none.
+
+// Use hardware SPI and the above for CS,DC and RST pins
+AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+
+void setup() {
+  Serial.begin(115200);
+  delay(3000);
+
+  pinMode(BACKLIGHT, OUTPUT);
+  digitalWrite(BACKLIGHT, HIGH);
+
+  tft.begin(8000000);
+  delay(1000);
+
+  Serial.println(F("case,x,y,length,breadth,radius,stroke,crc32"));
+
+  for (uint16_t i = 0; i < SHAPE_CASES; i++) runCase(i, shapeCase(i));
+
+  Serial.println(F("done"));
+}
+
+void loop(void) {}
+
+// Clears the frame with a plain window write rather than drawShape() or
+// fillScreen(), so a regression in the code under test can't leak into the
+// cases after it.
+void clearFrame() {
+  tft.setAddressWindow(0, 0, 239, 319);
+  tft.writeData16(ILI9341_BLACK, 240UL * 320);
+  tft.endWrite();
+}
+
+void runCase(uint16_t id, const ShapeCase &c) {
+  static uint16_t row[240];
+
+  clearFrame();
+  tft.drawShape(c.x, c.y, c.length, c.breadth, c.radius, c.stroke,
+                SHAPE_STROKE, SHAPE_FILL);
+
+  uint32_t crc = 0xFFFFFFFF;
+  for (uint16_t y = 0; y < 320; y++) {
+    tft.readPixels(0, y, 240, 1, row);
+    for (uint16_t x = 0; x < 240; x++) {
+      crc = crc32(crc, row[x] >> 8);
+      crc = crc32(crc, row[x] & 0xFF);
+    }
+
+#if DUMP_CASE >= 0
+    if (id == DUMP_CASE) printRow(y, row);
+#endif
+  }
+
+  Serial.print(id);
+  Serial.print(',');
+  Serial.print(c.x);
+  Serial.print(',');
+  Serial.print(c.y);
+  Serial.print(',');
+  Serial.print(c.length);
+  Serial.print(',');
+  Serial.print(c.breadth);
+  Serial.print(',');
+  Serial.print(c.radius);
+  Serial.print(',');
+  Serial.print(c.stroke);
+  Serial.print(',');
+  Serial.println(~crc, HEX);
+}
+
+// Standard (zlib) CRC32, one byte at a time.
+uint32_t crc32(uint32_t crc, uint8_t data) {
+  crc ^= data;
+  for (uint8_t i = 0; i < 8; i++) {
+    crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+  }
+  return crc;
+}
+
+// Prints a frame row as "row,<y>,<pixels as 4 hex digits each>".
+void printRow(uint16_t y, const uint16_t *row) {
+  Serial.print(F("row,"));
+  Serial.print(y);
+  Serial.print(',');
+  for (uint16_t x = 0; x < 240; x++) {
+    if (row[x] < 0x1000) Serial.print('0');
+    if (row[x] < 0x100) Serial.print('0');
+    if (row[x] < 0x10) Serial.print('0');
+    Serial.print(row[x], HEX);
+  }
+  Serial.println();
+}
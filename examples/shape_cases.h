@@ -0,0 +1,104 @@
+/*!
+ * @file shape_cases.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+// drawShape() cases shared by examples/shape_capture.ino, which runs them on
+// a board, and extras/host/shape_golden.cpp, which runs them on the host, so
+// that both compute the same frames.
+
+#ifndef _SHAPE_CASES_H_
+#define _SHAPE_CASES_H_
+
+#include <Arduino.h>
+
+#define SHAPE_RANDOM_CASES 2000  // Seeded random cases after the edge cases.
+#define SHAPE_RANDOM_SEED 0x2024
+
+#define SHAPE_STROKE 0xFFFF  // White stroke.
+#define SHAPE_FILL 0xF800    // Red fill.
+
+/*!
+  @brief drawShape() inputs of a single case.
+*/
+struct ShapeCase {
+  uint16_t x, y, length, breadth, radius;
+  uint8_t stroke;
+};
+
+// Edge cases of each drawShape() branch.
+static const ShapeCase shapeEdgeCases[] PROGMEM = {
+    {10, 10, 0, 0, 0, 0},      // Pixel fallback.
+    {239, 319, 0, 0, 0, 0},    // Pixel at the far corner.
+    {10, 10, 0, 0, 0, 3},      // Stroked pixel.
+    {10, 20, 100, 0, 0, 0},    // Horizontal line fallback.
+    {20, 10, 0, 100, 0, 0},    // Vertical line fallback.
+    {10, 20, 100, 0, 0, 2},    // Stroked horizontal line.
+    {0, 0, 240, 0, 0, 0},      // Full width line.
+    {0, 0, 0, 320, 0, 0},      // Full height line.
+    {10, 10, 100, 50, 0, 0},   // Rectangle.
+    {10, 10, 100, 50, 0, 1},   // Stroked rectangle.
+    {10, 10, 100, 50, 0, 10},  // Stroke wider than the gap to the edge.
+    {0, 0, 240, 320, 0, 0},    // Full screen rectangle.
+    {20, 20, 100, 50, 10, 0},  // Rounded rectangle.
+    {20, 20, 100, 50, 10, 3},  // Stroked rounded rectangle.
+    {20, 20, 100, 50, 25, 0},  // Radius of half the breadth.
+    {20, 20, 100, 50, 26, 0},  // Radius too large for the breadth.
+    {20, 20, 50, 100, 26, 0},  // Radius too large for the length.
+    {20, 20, 0, 0, 30, 0},     // Circle.
+    {20, 20, 0, 0, 30, 5},     // Stroked circle.
+    {0, 0, 0, 0, 120, 0},      // Circle as wide as the display.
+    {200, 280, 0, 0, 30, 0},   // Circle out of bounds.
+    {10, 10, 300, 20, 0, 0},   // Rectangle out of bounds.
+};
+
+#define SHAPE_EDGE_CASES (sizeof(shapeEdgeCases) / sizeof(shapeEdgeCases[0]))
+#define SHAPE_CASES (SHAPE_EDGE_CASES + SHAPE_RANDOM_CASES)
+
+/*!
+  @brief  Returns a case by number: the edge cases, then the random ones.
+          The random cases come from a small LCG, the same on every board
+          and host, and must be asked for in order after the edge cases.
+  @param  id  Case number, 0 to SHAPE_CASES - 1.
+  @return The drawShape() inputs.
+*/
+static ShapeCase shapeCase(uint16_t id) {
+  static uint32_t seed = SHAPE_RANDOM_SEED;
+  ShapeCase c;
+
+  if (id < SHAPE_EDGE_CASES) {
+    memcpy_P(&c, &shapeEdgeCases[id], sizeof(c));
+    return c;
+  }
+
+  uint16_t r[6];
+  for (uint8_t i = 0; i < 6; i++) {
+    seed = seed * 1103515245UL + 12345UL;
+    r[i] = (seed & 0xFFFFFFFFUL) >> 16;
+  }
+  c.x = r[0] % 240;
+  c.y = r[1] % 320;
+  c.length = r[2] % 241;
+  c.breadth = r[3] % 321;
+  c.radius = r[4] % 61;
+  c.stroke = r[5] % 9;
+  return c;
+}
+
+#endif  // end _SHAPE_CASES_H_
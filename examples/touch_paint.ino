@@ -0,0 +1,43 @@
+
+#include <AVR_ILI9341.h>
+#include <SPI.h>
+
+// For the Adafruit shield, these are the default.
+#define TFT_DC 8
+#define TFT_RST 9
+#define TFT_CS 10
+
+// XPT2046 touch controller on the same SPI bus.
+#define TOUCH_CS 7
+#define TOUCH_IRQ 2
+
+#define BACKLIGHT 4
+
+// Use hardware SPI and the above for CS,DC and RST pins
+AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+TFT_Touch touch(tft, TOUCH_CS, TOUCH_IRQ);
+
+uint16_t band = 0;
+
+void setup() {
+  pinMode(BACKLIGHT, OUTPUT);
+  digitalWrite(BACKLIGHT, HIGH);
+
+  touch.begin();  // Deselects the touch controller first.
+  tft.begin(8000000);
+  tft.setRotation(1);
+  tft.fillScreen(ILI9341_BLACK);
+}
+
+void loop(void) {
+  // Heavy drawing: a band sweeping down the bottom half of the screen.
+  uint16_t color = (band / 8) % 2 ? ILI9341_NAVY : ILI9341_DARKGREY;
+  tft.drawShape(0, 120 + band, 320, 8, 0, 0, color, color);
+  band = (band + 8) % 120;
+
+  // Sampled between two draw transactions, the bus is free.
+  uint16_t x, y;
+  if (touch.read(&x, &y) && y < 120) {
+    tft.drawShape(x, y, 3, 3, 0, 0, ILI9341_YELLOW, ILI9341_YELLOW);
+  }
+}
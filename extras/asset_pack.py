@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+"""Packs bitmaps and fonts into an asset pack for TFT_AssetPack.
+
+The manifest lists one asset per line as "<id> <kind> <file>", '#' starts a
+comment:
+
+    1   auto  icons/home.ppm     # Smallest of raw, rle and pal.
+    2   rle   splash.ppm
+    3   pal   buttons/ok.png     # Needs Pillow for other formats than PPM.
+    100 font  fonts/6x13.bdf     # Characters 32 to 126 of a BDF font.
+
+    python3 extras/asset_pack.py assets.txt -o ASSETS.BIN
+    python3 extras/asset_pack.py --list ASSETS.BIN
+
+Copy ASSETS.BIN to the SD card. The layout is documented in
+utility/TFT_Assets.h; asset data is 2-byte aligned so that raw pixels are
+never split across the reader's sector-sized reads.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+VERSION = 1
+RAW, RLE, PAL, FONT = 1, 2, 3, 4
+KINDS = {"raw": RAW, "rle": RLE, "pal": PAL, "font": FONT}
+NAMES = {RAW: "raw", RLE: "rle", PAL: "pal", FONT: "font"}
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def read_ppm(path):
+    """Returns (w, h, [565 pixels]) of a binary PPM (P6) image."""
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        sys.exit("%s: only 8-bit binary PPM (P6) is read without Pillow"
+                 % path)
+    w, h = int(fields[1]), int(fields[2])
+    pix = data[pos + 1:pos + 1 + 3 * w * h]
+    return w, h, [rgb565(*pix[i:i + 3]) for i in range(0, len(pix), 3)]
+
+
+def read_image(path):
+    if path.lower().endswith(".ppm"):
+        return read_ppm(path)
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("%s: install Pillow to read other formats than PPM" % path)
+    image = Image.open(path).convert("RGB")
+    w, h = image.size
+    return w, h, [rgb565(*p) for p in image.getdata()]
+
+
+def encode_raw(w, h, pixels):
+    return struct.pack("<HH", w, h) + \
+        b"".join(struct.pack(">H", p) for p in pixels)
+
+
+def encode_rle(w, h, pixels):
+    out = bytearray(struct.pack("<HH", w, h))
+    i, n = 0, len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out += struct.pack(">BH", 0x7F + run, pixels[i])
+            i += run
+            continue
+        # Literal pixels up to the next run of 2 or more.
+        start = i
+        while i < n and i - start < 128 and \
+                not (i + 1 < n and pixels[i + 1] == pixels[i]):
+            i += 1
+        out.append(i - start - 1)
+        out += b"".join(struct.pack(">H", p) for p in pixels[start:i])
+    return bytes(out)
+
+
+def encode_pal(w, h, pixels):
+    """Returns the palette encoding, None with more than 16 colors."""
+    colors = sorted(set(pixels))
+    if len(colors) > 16:
+        return None
+    bpp = 1 if len(colors) <= 2 else 2 if len(colors) <= 4 else 4
+    index = {c: i for i, c in enumerate(colors)}
+    out = bytearray(struct.pack("<HHBB", w, h, bpp, len(colors)))
+    out += b"".join(struct.pack(">H", c) for c in colors)
+    out += pack_rows(w, h, [index[p] for p in pixels], bpp)
+    return bytes(out)
+
+
+def pack_rows(w, h, values, bpp):
+    """Packs values row by row, most significant bits first, rows padded."""
+    out = bytearray()
+    for y in range(h):
+        byte, used = 0, 0
+        for v in values[y * w:(y + 1) * w]:
+            byte = (byte << bpp) | v
+            used += bpp
+            if used == 8:
+                out.append(byte)
+                byte, used = 0, 0
+        if used:
+            out.append(byte << (8 - used))
+    return out
+
+
+def read_bdf(path, first=32, last=126):
+    """Returns (height, {char: (width, [0/1 values])}) of a BDF font."""
+    glyphs, ascent, descent = {}, 0, 0
+    with open(path) as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "STARTCHAR":
+            code, dwidth, bbx, rows = None, 0, None, []
+            for line in lines:
+                words = line.split()
+                if words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    dwidth = int(words[1])
+                elif words[0] == "BBX":
+                    bbx = [int(v) for v in words[1:5]]
+                elif words[0] == "BITMAP":
+                    for line in lines:
+                        if line.startswith("ENDCHAR"):
+                            break
+                        rows.append(int(line, 16) << (32 - 4 * len(line)))
+                    break
+            if code is not None and first <= code <= last and bbx:
+                glyphs[code] = (dwidth, bbx, rows)
+
+    height = ascent + descent
+    out = {}
+    for code, (dwidth, (bw, bh, bx, by), rows) in glyphs.items():
+        values = [0] * (dwidth * height)
+        top = ascent - by - bh  # Glyph box row in the character cell.
+        for r, bits in enumerate(rows):
+            for c in range(bw):
+                x, y = bx + c, top + r
+                if bits & (1 << (31 - c)) and 0 <= x < dwidth and \
+                        0 <= y < height:
+                    values[y * dwidth + x] = 1
+        out[code] = (dwidth, values)
+    return height, out
+
+
+def encode_font(path):
+    height, glyphs = read_bdf(path)
+    if not glyphs:
+        sys.exit("%s: no glyphs from 32 to 126" % path)
+    first, last = min(glyphs), max(glyphs)
+    table, bitmaps = bytearray(), bytearray()
+    for code in range(first, last + 1):
+        width, values = glyphs.get(code, (0, []))
+        table += struct.pack("<BBH", width, 0, len(bitmaps))
+        bitmaps += pack_rows(width, height, values, 1)
+    if len(bitmaps) > 0xFFFF:
+        sys.exit("%s: glyph bitmaps over 64 KB" % path)
+    return struct.pack("<BBBB", first, last, height, 0) + table + bitmaps
+
+
+def encode(kind, path):
+    """Returns (type, data) of a manifest entry."""
+    if kind == "font":
+        return FONT, encode_font(path)
+    w, h, pixels = read_image(path)
+    candidates = {RAW: encode_raw(w, h, pixels), RLE: encode_rle(w, h, pixels)}
+    pal = encode_pal(w, h, pixels)
+    if pal is not None:
+        candidates[PAL] = pal
+    if kind == "auto":
+        return min(candidates.items(), key=lambda item: len(item[1]))
+    if KINDS[kind] not in candidates:
+        sys.exit("%s: more than 16 colors for a palette bitmap" % path)
+    return KINDS[kind], candidates[KINDS[kind]]
+
+
+def pack(manifest, output):
+    base = os.path.dirname(manifest)
+    assets = {}
+    with open(manifest) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            words = line.split(None, 2)
+            if len(words) != 3 or words[1] not in list(KINDS) + ["auto"]:
+                sys.exit("%s:%d: expected '<id> <kind> <file>'"
+                         % (manifest, number))
+            aid = int(words[0], 0)
+            if aid in assets or not 0 <= aid <= 0xFFFF:
+                sys.exit("%s:%d: duplicate or bad id" % (manifest, number))
+            assets[aid] = encode(words[1], os.path.join(base, words[2]))
+
+    body, entries = bytearray(), []
+    offset = 16
+    for aid in sorted(assets):
+        kind, data = assets[aid]
+        entries.append(struct.pack("<HBBII", aid, kind, 0, offset, len(data)))
+        body += data
+        offset += len(data)
+        pad = -offset % 2
+        body += b"\0" * pad
+        offset += pad
+
+    header = b"TFTA" + struct.pack("<BBHII", VERSION, 0, len(entries),
+                                   offset, 0)
+    with open(output, "wb") as f:
+        f.write(header + body + b"".join(entries))
+    for aid in sorted(assets):
+        kind, data = assets[aid]
+        print("%5d %-4s %7d bytes" % (aid, NAMES[kind], len(data)))
+    print("%d assets, %d bytes" % (len(entries), offset + 12 * len(entries)))
+
+
+def list_pack(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"TFTA" or data[4] != VERSION:
+        sys.exit("%s: not a version %d asset pack" % (path, VERSION))
+    count, index = struct.unpack_from("<HI", data, 6)
+    for i in range(count):
+        aid, kind, _, offset, size = struct.unpack_from(
+            "<HBBII", data, index + 12 * i)
+        print("%5d %-4s offset %7d %7d bytes" %
+              (aid, NAMES.get(kind, "?"), offset, size))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("input", help="manifest, or pack with --list")
+    parser.add_argument("-o", "--output", default="ASSETS.BIN",
+                        help="pack to write")
+    parser.add_argument("--list", action="store_true",
+                        help="list the assets of a pack")
+    args = parser.parse_args()
+
+    if args.list:
+        list_pack(args.input)
+    else:
+        pack(args.input, args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""Generates gamma and power tables for AVR_ILI9341::loadTable_P().
+
+Power settings are given in volts and converted to the register values of the
+ILI9341 datasheet. Lower VCOM and GVDD voltages lower the panel's drive power
+at the cost of contrast:
+
+    python3 extras/gamma_table.py --gvdd 4.4 --vcomh 4.0 --vcoml -1.3
+
+Gamma is tuned from measured curves. A measurement is a CSV of "level,
+luminance" lines: the gray level drawn, 0 to 255 with both ends included, and
+the luminance read by a light meter over it, in any unit. The panel's response
+to the mid-tone registers differs per batch, so it is measured rather than
+modelled:
+
+    python3 extras/gamma_table.py --probe-table --name probe > probe.h
+    # Measure base.csv with the current table and probe.csv with probe.h.
+    python3 extras/gamma_table.py --measured base.csv --probe probe.csv \\
+        --target 2.2 --name panelTable -o panel_table.h
+
+The probe table shifts the four mid-tone points (VP43, VP20, VN43 and VN20) by
+--step. The gamma exponents fitted to both curves give the shift reaching
+--target; measure again with the result and repeat if needed. Then in the
+sketch:
+
+    #include "panel_table.h"
+    tft.begin();
+    tft.loadTable_P(panelTable);
+
+The table starts from the init script's values, --pos and --neg replace them.
+"""
+
+import argparse
+import math
+import sys
+
+# GMCTRP1 and GMCTRN1 of initcmd in AVR_ILI9341.cpp.
+POS = [0x0F, 0x35, 0x31, 0x0B, 0x0E, 0x06, 0x49, 0xA7,
+       0x33, 0x07, 0x0F, 0x03, 0x0C, 0x0A, 0x00]
+NEG = [0x00, 0x0A, 0x0F, 0x04, 0x11, 0x08, 0x36, 0x58,
+       0x4D, 0x07, 0x10, 0x0C, 0x32, 0x34, 0x0F]
+
+# Bytes of the 7-bit mid-tone points: VP43 and VP20, VN20 and VN43.
+MID_POS = (6, 8)
+MID_NEG = (6, 8)
+
+
+def read_curve(path):
+    """Returns [(level 0-1, luminance 0-1)] of a measurement CSV."""
+    points = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            try:
+                level, lum = (float(v) for v in line.split(","))
+            except ValueError:
+                sys.exit("%s:%d: expected 'level,luminance'" % (path, number))
+            points.append((level / 255.0, lum))
+    if len(points) < 3:
+        sys.exit("%s: at least 3 points are needed" % path)
+    low = min(p[1] for p in points)
+    high = max(p[1] for p in points)
+    if high <= low:
+        sys.exit("%s: the luminance doesn't change" % path)
+    return [(x, (y - low) / (high - low)) for x, y in points]
+
+
+def fit_gamma(points):
+    """Least squares exponent of y = x ** gamma over the mid-tones."""
+    logs = [(math.log(x), math.log(y)) for x, y in points
+            if 0.05 <= x <= 0.95 and y > 0]
+    if len(logs) < 2:
+        sys.exit("measure at least 2 levels between 13 and 242")
+    return sum(lx * ly for lx, ly in logs) / sum(lx * lx for lx, _ in logs)
+
+
+def shift_mid(pos, neg, delta):
+    pos, neg = list(pos), list(neg)
+    for i in MID_POS:
+        pos[i] = max(0, min(0x7F, pos[i] + delta))
+    for i in MID_NEG:
+        neg[i] = max(0, min(0x7F, neg[i] + delta))
+    return pos, neg
+
+
+def register(volts, base, step, low, high, name):
+    value = int(round((volts - base) / step))
+    if not low <= value <= high:
+        sys.exit("%s %.3f V is out of range" % (name, volts))
+    return value
+
+
+def parse_bytes(text, count, name):
+    values = [int(v, 16) for v in text.replace(",", " ").split()]
+    if len(values) != count or not all(0 <= v <= 0xFF for v in values):
+        sys.exit("%s needs %d hex bytes" % (name, count))
+    return values
+
+
+def hex_list(values):
+    return ", ".join("0x%02X" % v for v in values)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--pos", help="15 GMCTRP1 hex bytes to start from")
+    parser.add_argument("--neg", help="15 GMCTRN1 hex bytes to start from")
+    parser.add_argument("--probe-table", action="store_true",
+                        help="write the table to measure probe.csv with")
+    parser.add_argument("--measured", help="curve of the starting table")
+    parser.add_argument("--probe", help="curve of the probe table")
+    parser.add_argument("--target", type=float, default=2.2,
+                        help="gamma exponent to reach")
+    parser.add_argument("--step", type=int, default=8,
+                        help="mid-tone shift of the probe table")
+    parser.add_argument("--gvdd", type=float,
+                        help="GVDD in volts, 3.00 to 6.00 (PWCTR1)")
+    parser.add_argument("--vcomh", type=float,
+                        help="VCOMH in volts, 2.700 to 5.200 (VMCTR1)")
+    parser.add_argument("--vcoml", type=float,
+                        help="VCOML in volts, -2.500 to 0.000 (VMCTR1)")
+    parser.add_argument("--vcom-offset", type=int,
+                        help="VCOM offset, -64 to 63 (VMCTR2)")
+    parser.add_argument("--name", default="gammaTable",
+                        help="C name of the table")
+    parser.add_argument("--ram", action="store_true",
+                        help="table in RAM for loadTable(), not PROGMEM")
+    parser.add_argument("-o", "--output", help="header to write, else stdout")
+    args = parser.parse_args()
+
+    pos = parse_bytes(args.pos, 15, "--pos") if args.pos else POS
+    neg = parse_bytes(args.neg, 15, "--neg") if args.neg else NEG
+    notes = []
+
+    if args.probe_table:
+        pos, neg = shift_mid(pos, neg, args.step)
+        notes.append("probe: mid-tones shifted by %d" % args.step)
+    elif args.measured:
+        if not args.probe:
+            sys.exit("--measured needs --probe, see --probe-table")
+        base = fit_gamma(read_curve(args.measured))
+        probe = fit_gamma(read_curve(args.probe))
+        if abs(probe - base) < 0.01:
+            sys.exit("the probe table didn't change the gamma (%.3f), "
+                     "try a larger --step" % base)
+        delta = int(round((args.target - base) * args.step / (probe - base)))
+        pos, neg = shift_mid(pos, neg, delta)
+        notes.append("gamma %.2f, probe %.2f: mid-tones shifted by %d "
+                     "for %.2f" % (base, probe, delta, args.target))
+
+    rows = [("ILI9341_GMCTRP1", pos), ("ILI9341_GMCTRN1", neg)]
+    if args.gvdd is not None:
+        rows.append(("ILI9341_PWCTR1",
+                     [register(args.gvdd, 2.85, 0.05, 0x03, 0x3F, "GVDD")]))
+    if args.vcomh is not None or args.vcoml is not None:
+        if args.vcomh is None or args.vcoml is None:
+            sys.exit("VMCTR1 needs both --vcomh and --vcoml")
+        rows.append(("ILI9341_VMCTR1",
+                     [register(args.vcomh, 2.7, 0.025, 0, 0x64, "VCOMH"),
+                      register(args.vcoml, -2.5, 0.025, 0, 0x64, "VCOML")]))
+    if args.vcom_offset is not None:
+        if not -64 <= args.vcom_offset <= 63:
+            sys.exit("--vcom-offset is -64 to 63")
+        rows.append(("ILI9341_VMCTR2", [0x80 | (args.vcom_offset + 64)]))
+
+    name = args.name
+    out = ["// Generated by extras/gamma_table.py, do not edit."]
+    out += ["// %s." % note for note in notes]
+    out += [
+        "",
+        "#include <AVR_ILI9341.h>",
+        "",
+        "static const uint8_t %s[]%s = {" %
+        (name, "" if args.ram else " PROGMEM"),
+    ]
+    for cmd, values in rows:
+        out.append("    %s, %d," % (cmd, len(values)))
+        out.append("    %s," % hex_list(values[:8]))
+        if values[8:]:
+            out.append("    %s," % hex_list(values[8:]))
+    out += ["    ILI9341_NOP,", "};", ""]
+    text = "\n".join(out)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
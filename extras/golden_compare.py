@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Compares shape_capture.ino runs against a reference run.
+
+examples/shape_capture.ino prints one CSV row per drawShape() case with the
+CRC32 of the frame read back from the display, and optionally the frame of a
+single case as "row,<y>,<hex pixels>" lines. extras/host/shape_golden.cpp
+prints the same from an emulated panel, with --frames every frame as the
+spans of non-black pixels, "span,<y>,<x>,<count>,<hex color>". A case's
+frame lines come before its CSV row. The reference of the current library is
+extras/host/shape_golden.txt.xz, that output compressed:
+
+    ./shape_golden --frames > run.txt
+    python3 extras/golden_compare.py extras/host/shape_golden.txt.xz run.txt \\
+        --diff diff/
+
+lists the cases whose frame changed and, with --diff, writes an image of
+each one that has a frame in both logs: unchanged pixels are dimmed
+reference pixels, changed ones are magenta. Logs ending in .xz or .gz are
+read compressed.
+"""
+
+import argparse
+import gzip
+import lzma
+import os
+import sys
+
+WIDTH, HEIGHT = 240, 320
+
+
+def open_log(path):
+    if path.endswith(".xz"):
+        return lzma.open(path, "rt")
+    if path.endswith(".gz"):
+        return gzip.open(path, "rt")
+    return open(path)
+
+
+def parse_log(path):
+    """Returns {case: (params, crc, [frame lines] or None)} of a log."""
+    cases, pending = {}, []
+    with open_log(path) as f:
+        for line in f:
+            fields = line.strip().split(",")
+            if fields[0] in ("row", "span"):
+                pending.append(fields)
+            elif len(fields) == 8 and fields[0].isdigit():
+                cases[int(fields[0])] = (",".join(fields[1:7]),
+                                         int(fields[7], 16), pending or None)
+                pending = []
+    return cases
+
+
+def frame(lines):
+    """Builds a frame, rows of pixels, from its "row" or "span" lines."""
+    pixels = [[0] * WIDTH for _ in range(HEIGHT)]
+    for fields in lines:
+        y = int(fields[1])
+        if fields[0] == "row":
+            hexdata = fields[2]
+            pixels[y] = [int(hexdata[i:i + 4], 16)
+                         for i in range(0, 4 * WIDTH, 4)]
+        else:
+            x, count = int(fields[2]), int(fields[3])
+            pixels[y][x:x + count] = [int(fields[4], 16)] * count
+    return pixels
+
+
+def rgb(pixel):
+    r, g, b = (pixel >> 11) & 0x1F, (pixel >> 5) & 0x3F, pixel & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def write_diff(ref, run, path):
+    """Writes the per-pixel diff of two frames as a binary PPM image."""
+    changed = 0
+    out = bytearray()
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if ref[y][x] != run[y][x]:
+                changed += 1
+                out += bytes((255, 0, 255))
+            else:
+                out += bytes(c // 3 for c in rgb(ref[y][x]))
+    with open(path, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (WIDTH, HEIGHT))
+        f.write(out)
+    return changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("reference", help="log of the reference run")
+    parser.add_argument("run", help="log of the run to check")
+    parser.add_argument("--diff", metavar="DIR",
+                        help="write case<N>.ppm diff images of changed cases")
+    args = parser.parse_args()
+
+    ref_cases = parse_log(args.reference)
+    run_cases = parse_log(args.run)
+    if args.diff:
+        os.makedirs(args.diff, exist_ok=True)
+
+    failed = 0
+    for case in sorted(ref_cases):
+        params, crc, ref_lines = ref_cases[case]
+        if case not in run_cases:
+            print("case %d (%s): missing from run" % (case, params))
+            failed += 1
+            continue
+        if run_cases[case][0] != params:
+            print("case %d: inputs differ, %s vs %s" %
+                  (case, params, run_cases[case][0]))
+            failed += 1
+            continue
+        if run_cases[case][1] == crc:
+            continue
+
+        failed += 1
+        note = ""
+        run_lines = run_cases[case][2]
+        if args.diff and ref_lines is None:
+            note = ", no reference frame"
+        elif args.diff and run_lines is None:
+            note = ", no frame in the run (--frames or DUMP_CASE)"
+        elif args.diff:
+            path = os.path.join(args.diff, "case%d.ppm" % case)
+            changed = write_diff(frame(ref_lines), frame(run_lines), path)
+            note = ", %d pixels differ, see %s" % (changed, path)
+        print("case %d (%s): frame changed%s" % (case, params, note))
+
+    print("%d of %d cases differ" % (failed, len(ref_cases)))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
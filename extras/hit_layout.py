@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Generates a static TFT_Hit layout: widget rectangles and their grid index.
+
+The input lists one widget per line as "id,x,y,w,h", in the coordinates of the
+rotation the screen is laid out at. Widgets listed later are drawn over the
+earlier ones and win the hit test where they overlap. '#' starts a comment.
+
+    python3 extras/hit_layout.py menu.csv --name menuLayout -o menu_layout.h
+    python3 extras/hit_layout.py keypad.csv --rotation 1 --name keypadLayout
+
+Then in the sketch:
+
+    #include "menu_layout.h"
+    TFT_Hit hits(tft);
+    hits.setLayout(&menuLayout);
+    uint16_t id = hits.hit(x, y);
+
+The rectangles are stored at rotation 0 and hit() converts the touched point
+from the display's current rotation, so one layout serves every rotation.
+"""
+
+import argparse
+import sys
+
+WIDTH, HEIGHT = 240, 320  # Display size at rotation 0.
+
+
+def to_native(x, y, rotation):
+    """Converts a point at `rotation` to rotation 0, as TFT_Hit::toNative()."""
+    if rotation == 1:
+        return WIDTH - 1 - y, x
+    if rotation == 2:
+        return WIDTH - 1 - x, HEIGHT - 1 - y
+    if rotation == 3:
+        return y, HEIGHT - 1 - x
+    return x, y
+
+
+def read_rects(path, rotation):
+    """Returns [(x, y, w, h, id)] at rotation 0."""
+    width, height = (HEIGHT, WIDTH) if rotation % 2 else (WIDTH, HEIGHT)
+    rects = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            wid, x, y, w, h = (int(v, 0) for v in line.split(","))
+            if w <= 0 or h <= 0 or x + w > width or y + h > height or \
+                    not 0 <= wid < 0xFFFF:
+                sys.exit("%s:%d: widget off the %dx%d display or bad id"
+                         % (path, number, width, height))
+            x1, y1 = to_native(x, y, rotation)
+            x2, y2 = to_native(x + w - 1, y + h - 1, rotation)
+            x1, x2 = min(x1, x2), max(x1, x2)
+            y1, y2 = min(y1, y2), max(y1, y2)
+            rects.append((x1, y1, x2 - x1 + 1, y2 - y1 + 1, wid))
+    return rects
+
+
+def build_cells(rects, cell):
+    """Returns the rectangle indices over each cell, topmost first."""
+    cols, rows = WIDTH // cell, HEIGHT // cell
+    cells = [[] for _ in range(cols * rows)]
+    for index in reversed(range(len(rects))):
+        x, y, w, h, _ = rects[index]
+        for row in range(y // cell, (y + h - 1) // cell + 1):
+            for col in range(x // cell, (x + w - 1) // cell + 1):
+                cells[row * cols + col].append(index)
+    return cells
+
+
+def wrap(values, indent="    ", width=80):
+    lines, line = [], indent
+    for value in values:
+        item = value + ", "
+        if len(line) + len(item.rstrip()) > width:
+            lines.append(line.rstrip())
+            line = indent
+        line += item
+    if line.strip():
+        lines.append(line.rstrip())
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("layout",
+                        help="widget list, one 'id,x,y,w,h' per line")
+    parser.add_argument("--name", default="layout",
+                        help="C name of the layout")
+    parser.add_argument("--rotation", type=int, default=0, choices=range(4),
+                        help="rotation the coordinates are given at")
+    parser.add_argument("--cell", type=int, default=40,
+                        help="grid cell side, must match TFT_HIT_CELL")
+    parser.add_argument("-o", "--output", help="header to write, else stdout")
+    args = parser.parse_args()
+
+    if WIDTH % args.cell or HEIGHT % args.cell:
+        sys.exit("the cell side must divide 240 and 320")
+
+    rects = read_rects(args.layout, args.rotation)
+    if not rects:
+        sys.exit("%s: no widgets" % args.layout)
+    cells = build_cells(rects, args.cell)
+
+    starts, entries = [0], []
+    for indices in cells:
+        entries += indices
+        starts.append(len(entries))
+
+    name = args.name
+    out = [
+        "// Generated by extras/hit_layout.py from %s, do not edit." %
+        args.layout,
+        "// %d widgets, %d cell entries, %d bytes of PROGMEM." %
+        (len(rects), len(entries),
+         10 * len(rects) + 2 * (len(starts) + len(entries)) + 6),
+        "",
+        "#include <AVR_ILI9341.h>",
+        "",
+        "#if TFT_HIT_CELL != %d" % args.cell,
+        "#error \"%s was generated for %d pixel cells\"" % (name, args.cell),
+        "#endif",
+        "",
+        "static const TFT_HitRect %s_rects[] PROGMEM = {" % name,
+        wrap("{%d, %d, %d, %d, %d}" % r for r in rects),
+        "};",
+        "",
+        "static const uint16_t %s_cellStart[] PROGMEM = {" % name,
+        wrap(str(v) for v in starts),
+        "};",
+        "",
+        "static const uint16_t %s_cellRects[] PROGMEM = {" % name,
+        wrap(str(v) for v in entries),
+        "};",
+        "",
+        "static const TFT_HitLayout %s PROGMEM = {" % name,
+        "    %s_rects, %s_cellStart, %s_cellRects};" % (name, name, name),
+        "",
+    ]
+    text = "\n".join(out)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,46 @@
+/*!
+ * @file Arduino.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+// Just enough of the Arduino core for host builds of the drawing code
+// (TFT_Draw, TFT_GFX, TFT_Color, Adafruit_GFX) under g++ or clang++, see
+// host_panel.h.
+
+#ifndef _TFT_HOST_ARDUINO_H_
+#define _TFT_HOST_ARDUINO_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P memcpy
+
+// As defined by the AVR core, so the host rounds like the board does.
+#define round(x) ((x) >= 0 ? (long)((x) + 0.5) : (long)((x)-0.5))
+
+#endif  // end _TFT_HOST_ARDUINO_H_
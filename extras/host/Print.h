@@ -0,0 +1,47 @@
+/*!
+ * @file Print.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+
+// Print for host builds of Adafruit_GFX, which prints its text through it.
+
+#ifndef _TFT_HOST_PRINT_H_
+#define _TFT_HOST_PRINT_H_
+
+#include "Arduino.h"
+
+/*!
+  @brief  The part of the core's Print class the text code uses.
+*/
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t print(const char *s) {
+    size_t n = 0;
+    while (*s) n += write(*s++);
+    return n;
+  }
+
+  size_t println(const char *s = "") { return print(s) + write('\n'); }
+};
+
+#endif  // end _TFT_HOST_PRINT_H_
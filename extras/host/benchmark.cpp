@@ -0,0 +1,239 @@
+/*!
+ * @file benchmark.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+
+// Runs the tests of examples/benchmark.ino on HostPanel and prints one CSV row
+// per test, under the same names. The host can't time the bus, so pixels and
+// the bytes the display would be sent stand in for the microseconds: a change
+// to the drawing code shows up here before it is timed on a board.
+//
+//   g++ -O2 -DARDUINO=100 -I. -Iextras/host -Iutility -o benchmark
+//       extras/host/benchmark.cpp utility/TFT_GFX.cpp utility/Adafruit_GFX.cpp
+//   ./benchmark
+//
+// Columns: test, pixels written, spi_bytes as TFT_ENABLE_STATS counts them,
+// bytes_per_pixel and pixel_pct, the share of the bytes that are pixel data
+// rather than window commands. Keep the tests in step with benchmark.ino.
+// The exit status is 1 if a transfer broke HostPanel's window invariants.
+
+#include <stdio.h>
+
+#include "../../examples/bench_text.h"
+#include "host_panel.h"
+
+#define BLACK 0x0000
+#define NAVY 0x000F
+#define OLIVE 0x7BE0
+#define BLUE 0x001F
+#define GREEN 0x07E0
+#define CYAN 0x07FF
+#define RED 0xF800
+#define MAGENTA 0xF81F
+#define YELLOW 0xFFE0
+#define WHITE 0xFFFF
+
+#define IMAGE_SIDE 16
+
+/*!
+  @brief  HostFast is TFT_Fast for HostPanel: the same drawing code, with the
+          device calls statically dispatched.
+*/
+class HostFast : public TFT_Draw<HostFast> {
+ public:
+  explicit HostFast(HostPanel &dev) : _dev(dev) {}
+
+  uint16_t width(void) const { return _dev.width(); }
+  uint16_t height(void) const { return _dev.height(); }
+
+  void setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    _dev.HostPanel::setAddressWindow(x1, y1, x2, y2);
+  }
+
+  void writeData16(uint16_t color, uint32_t num) {
+    _dev.HostPanel::writeData16(color, num);
+  }
+
+  void endWrite(void) { _dev.HostPanel::endWrite(); }
+
+ private:
+  HostPanel &_dev;  ///< Device drawn on.
+};
+
+static HostPanel tft;
+static HostFast fast(tft);
+static TextCanvas text(tft);
+static uint16_t image[IMAGE_SIDE * IMAGE_SIDE];
+static uint64_t startPixels;
+
+static void startTest(void) {
+  tft.resetSPIBytes();
+  startPixels = tft.pixels();
+}
+
+static void endTest(const char *name) {
+  uint32_t pixels = tft.pixels() - startPixels;
+  uint32_t bytes = tft.spiBytes();
+
+  printf("%s,%lu,%lu,%.3f,%.1f\n", name, (unsigned long)pixels,
+         (unsigned long)bytes, pixels ? (double)bytes / pixels : 0.0,
+         bytes ? 200.0 * pixels / bytes : 0.0);
+}
+
+static void benchFillScreen(void) {
+  startTest();
+  tft.fillScreen(BLACK);
+  tft.fillScreen(RED);
+  tft.fillScreen(GREEN);
+  tft.fillScreen(BLUE);
+  tft.fillScreen(BLACK);
+  endTest("fill_screen");
+}
+
+static void benchFastFillScreen(void) {
+  startTest();
+  fast.fillScreen(BLACK);
+  fast.fillScreen(RED);
+  fast.fillScreen(GREEN);
+  fast.fillScreen(BLUE);
+  fast.fillScreen(BLACK);
+  endTest("fast_fill_screen");
+}
+
+static void benchHorizontalSpans(void) {
+  startTest();
+  for (uint16_t y = 0; y < 300; y += 3) {
+    tft.drawShape(10, y, 200, 0, 0, 0, 0, YELLOW);
+  }
+  endTest("h_spans");
+
+  startTest();
+  for (uint16_t y = 0; y < 300; y += 3) {
+    fast.drawShape(10, y, 200, 0, 0, 0, 0, CYAN);
+  }
+  endTest("fast_h_spans");
+}
+
+static void benchVerticalSpans(void) {
+  startTest();
+  for (uint16_t x = 0; x < 230; x += 3) {
+    tft.drawShape(x, 10, 0, 280, 0, 0, 0, MAGENTA);
+  }
+  endTest("v_spans");
+}
+
+static void benchPixels(void) {
+  startTest();
+  for (uint16_t i = 0; i < 1000; i++) {
+    tft.drawShape((i * 7) % 230, (i * 13) % 310, 0, 0, 0, 0, 0, i);
+  }
+  endTest("pixels");
+}
+
+static void benchRects(void) {
+  tft.fillScreen(BLACK);
+  startTest();
+  for (uint16_t side = 10; side < 200; side += 10) {
+    tft.drawShape(20, 20, side, side, 0, 0, 0, side * 97);
+  }
+  endTest("rects");
+
+  startTest();
+  for (uint16_t side = 10; side < 200; side += 10) {
+    tft.drawShape(20, 20, side, side, 0, 2, WHITE, side * 97);
+  }
+  endTest("rects_stroke_2");
+}
+
+static void benchRoundRects(void) {
+  static const uint8_t radii[] = {2, 5, 10, 20};
+  static const uint8_t strokes[] = {0, 1, 3};
+  char name[32];
+
+  for (uint8_t r = 0; r < sizeof(radii); r++) {
+    for (uint8_t s = 0; s < sizeof(strokes); s++) {
+      tft.fillScreen(BLACK);
+      startTest();
+      for (uint8_t i = 0; i < 10; i++) {
+        tft.drawShape(20 + i, 20 + i, 120, 80, radii[r], strokes[s], WHITE,
+                      NAVY);
+      }
+      snprintf(name, sizeof(name), "round_rect_r%u_s%u", radii[r], strokes[s]);
+      endTest(name);
+
+      startTest();
+      for (uint8_t i = 0; i < 10; i++) {
+        fast.drawShape(20 + i, 20 + i, 120, 80, radii[r], strokes[s], WHITE,
+                       OLIVE);
+      }
+      snprintf(name, sizeof(name), "fast_round_rect_r%u_s%u", radii[r],
+               strokes[s]);
+      endTest(name);
+    }
+  }
+}
+
+static void benchImage(void) {
+  for (uint16_t i = 0; i < IMAGE_SIDE * IMAGE_SIDE; i++) image[i] = i * 31;
+
+  startTest();
+  for (uint16_t y = 0; y + IMAGE_SIDE <= 320; y += IMAGE_SIDE) {
+    for (uint16_t x = 0; x + IMAGE_SIDE <= 240; x += IMAGE_SIDE) {
+      tft.drawImage(x, y, IMAGE_SIDE, IMAGE_SIDE, image);
+    }
+  }
+  endTest("image_16x16");
+}
+
+static void benchText(void) {
+  tft.fillScreen(BLACK);
+  startTest();
+  printBenchText(text);
+  endTest("text");
+}
+
+static void benchScroll(void) {
+  startTest();
+  for (uint16_t y = 0; y <= 320; y++) {
+    tft.scrollTo(y % 320);
+  }
+  endTest("scroll_320");
+}
+
+int main(void) {
+  printf("test,pixels,spi_bytes,bytes_per_pixel,pixel_pct\n");
+
+  benchFillScreen();
+  benchFastFillScreen();
+  benchHorizontalSpans();
+  benchVerticalSpans();
+  benchPixels();
+  benchRects();
+  benchRoundRects();
+  benchImage();
+  benchText();
+  benchScroll();
+
+  if (tft.error()[0]) {
+    fprintf(stderr, "%s\n", tft.error());
+    return 1;
+  }
+  return 0;
+}
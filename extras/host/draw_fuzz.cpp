@@ -0,0 +1,159 @@
+/*!
+ * @file draw_fuzz.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+// Fuzzes the public TFT_GFX entry points on HostPanel and aborts on the first
+// call that breaks a window invariant (off the display, or a pixel count
+// other than the window's area) or writes more than TFT_FUZZ_MAX_SCREENS
+// screens of pixels, i.e. a runaway transfer.
+//
+// Each 12 byte record of the input is one call: byte 0 picks drawShape(),
+// fillScreen() or a rotation, then come x, y, length, breadth and radius as
+// little-endian uint16_t and the stroke width. With libFuzzer, or AFL++'s
+// afl-clang-fast++ in place of clang++:
+//
+//   clang++ -g -O1 -fsanitize=fuzzer,address -Iextras/host -Iutility
+//       extras/host/draw_fuzz.cpp utility/TFT_GFX.cpp -o draw_fuzz
+//   ./draw_fuzz corpus/
+//
+// Without a fuzzing engine, -DDRAW_FUZZ_MAIN adds a main() that replays
+// input files, e.g. a crash found above, or runs seeded random inputs:
+//
+//   g++ -O2 -DDRAW_FUZZ_MAIN -Iextras/host -Iutility
+//       extras/host/draw_fuzz.cpp utility/TFT_GFX.cpp -o draw_fuzz
+//   ./draw_fuzz --random 100000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_panel.h"
+
+#ifndef TFT_FUZZ_MAX_SCREENS
+#define TFT_FUZZ_MAX_SCREENS 8  ///< Pixels per call before it's a runaway.
+#endif
+
+#define RECORD_BYTES 12  ///< Input bytes per call.
+
+static HostPanel panel;
+
+static uint16_t word(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+// Runs one record and aborts with its description if it misbehaved.
+static void runRecord(const uint8_t *r) {
+  char call[96];
+  uint64_t before = panel.pixels();
+
+  switch (r[0] % 3) {
+    case 0:
+      snprintf(call, sizeof(call), "drawShape(%u, %u, %u, %u, %u, %u)",
+               word(r + 1), word(r + 3), word(r + 5), word(r + 7),
+               word(r + 9), r[11]);
+      panel.drawShape(word(r + 1), word(r + 3), word(r + 5), word(r + 7),
+                      word(r + 9), r[11], 0xFFFF, 0xF800);
+      break;
+    case 1:
+      snprintf(call, sizeof(call), "fillScreen(0x%04X)", word(r + 1));
+      panel.fillScreen(word(r + 1));
+      break;
+    default:
+      snprintf(call, sizeof(call), "setRotation(%u)", r[1] & 3);
+      panel.setRotation(r[1]);
+      break;
+  }
+
+  uint64_t written = panel.pixels() - before;
+  uint64_t limit = (uint64_t)TFT_FUZZ_MAX_SCREENS * panel.width() *
+                   panel.height();
+  if (panel.error()[0] || written > limit) {
+    fprintf(stderr, "rotation %u, %s: %s%llu pixels written\n",
+            panel.getRotation(), call, panel.error()[0] ? "" : "runaway, ",
+            (unsigned long long)written);
+    if (panel.error()[0]) fprintf(stderr, "%s\n", panel.error());
+    abort();
+  }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  panel.setRotation(0);
+  for (; size >= RECORD_BYTES; data += RECORD_BYTES, size -= RECORD_BYTES) {
+    runRecord(data);
+  }
+  return 0;
+}
+
+#ifdef DRAW_FUZZ_MAIN
+static uint32_t seed;
+
+static uint8_t nextByte() {
+  seed = seed * 1103515245UL + 12345UL;
+  return seed >> 16;
+}
+
+// Random records, most values near the display so that they pass the
+// bounds checks and reach the wrap-prone math.
+static void randomRecord(uint8_t *r) {
+  r[0] = nextByte();
+  r[1] = nextByte();
+  for (uint8_t i = 1; i < 11; i += 2) {
+    uint16_t v = nextByte() | (nextByte() << 8);
+    if (nextByte() & 7) v %= nextByte() & 1 ? 330 : 130;  // Else left raw.
+    r[i] = v;
+    r[i + 1] = v >> 8;
+  }
+  r[11] = nextByte() & 1 ? nextByte() % 12 : nextByte();
+}
+
+int main(int argc, char **argv) {
+  if (argc >= 3 && strcmp(argv[1], "--random") == 0) {
+    unsigned long count = strtoul(argv[2], NULL, 0);
+    seed = argc >= 4 ? strtoul(argv[3], NULL, 0) : 1;
+    uint8_t input[4 * RECORD_BYTES];
+    for (unsigned long n = 0; n < count; n++) {
+      for (size_t i = 0; i < sizeof(input); i += RECORD_BYTES) {
+        randomRecord(input + i);
+      }
+      LLVMFuzzerTestOneInput(input, sizeof(input));
+    }
+    printf("%lu random inputs passed\n", count);
+    return 0;
+  }
+
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <input>... | --random <count> [seed]\n",
+            argv[0]);
+    return 2;
+  }
+
+  for (int i = 1; i < argc; i++) {
+    FILE *f = fopen(argv[i], "rb");
+    if (!f) {
+      perror(argv[i]);
+      return 2;
+    }
+    static uint8_t input[1 << 16];
+    size_t size = fread(input, 1, sizeof(input), f);
+    fclose(f);
+    LLVMFuzzerTestOneInput(input, size);
+    printf("%s passed\n", argv[i]);
+  }
+  return 0;
+}
+#endif
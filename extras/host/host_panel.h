@@ -0,0 +1,207 @@
+/*!
+ * @file host_panel.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+// Host builds put this directory ahead of utility/ on the include path, so
+// its Arduino.h stands in for the core. From the repository root:
+//   g++ -Iextras/host -Iutility extras/host/<test>.cpp utility/TFT_GFX.cpp
+
+#ifndef _TFT_HOST_PANEL_H_
+#define _TFT_HOST_PANEL_H_
+
+#include <stdio.h>
+
+#include "TFT_GFX.h"
+
+#define HOST_PANEL_WIDTH 240   ///< Panel width at rotation 0.
+#define HOST_PANEL_HEIGHT 320  ///< Panel height at rotation 0.
+
+// Bytes AVR_ILI9341 sends to open a window: CASET, PASET and their 4 bytes of
+// data each, then RAMWR.
+#define HOST_PANEL_WINDOW_BYTES 11
+
+/*!
+  @brief  HostPanel emulates the display's frame memory for host builds. It
+          is a TFT_GFX, so the drawing code runs exactly as on the board, and
+          checks every transfer: each window must lie on the display and be
+          filled by exactly its area, in one writeData16() call. Rotations
+          only swap the width and height, the frame is kept row by row at
+          the current one. The bytes the display would be sent are counted
+          as TFT_ENABLE_STATS counts them.
+*/
+class HostPanel : public TFT_GFX {
+ public:
+  HostPanel() : TFT_GFX(HOST_PANEL_WIDTH, HOST_PANEL_HEIGHT) {
+    _x1 = _y1 = _x2 = _y2 = 0;
+    _open = false;
+    _pixels = 0;
+    _spiBytes = 0;
+    _error[0] = '\0';
+    clear(0);
+  }
+
+  void setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    if (_open) fail("window (%lu, %lu) opened before endWrite()", x1, y1);
+    if (x1 > x2 || y1 > y2 || x2 >= _width || y2 >= _height)
+      fail("window (%lu, %lu)-(%lu, %lu) is off the display", x1, y1, x2, y2);
+    _x1 = x1;
+    _y1 = y1;
+    _x2 = x2;
+    _y2 = y2;
+    _open = true;
+    _spiBytes += HOST_PANEL_WINDOW_BYTES;
+  }
+
+  void writeData16(uint16_t color, uint32_t num) {
+    uint32_t area = (uint32_t)(_x2 - _x1 + 1) * (_y2 - _y1 + 1);
+    if (!_open) fail("%lu pixels written without a window", (unsigned long)num);
+    if (num != area)
+      fail("%lu pixels written to a window of %lu", (unsigned long)num,
+           (unsigned long)area);
+    if (_error[0]) return;  // The window can't be trusted.
+
+    _pixels += num;
+    _spiBytes += 2 * num;
+    for (uint16_t y = _y1; y <= _y2; y++) {
+      for (uint16_t x = _x1; x <= _x2; x++) _frame[y * _width + x] = color;
+    }
+  }
+
+  void endWrite(void) { _open = false; }
+
+  /*!
+      @brief  Draws an image as AVR_ILI9341::drawImage() does.
+      @param  x    Column of the image's top-left corner.
+      @param  y    Row of the image's top-left corner.
+      @param  w    Image width in pixels.
+      @param  h    Image height in pixels.
+      @param  img  The w * h pixels of the image, row by row.
+  */
+  void drawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 const uint16_t *img) {
+    if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+
+    _pixels += (uint32_t)w * h;
+    _spiBytes += HOST_PANEL_WINDOW_BYTES + 2 * (uint32_t)w * h;
+    for (uint16_t j = 0; j < h; j++) {
+      for (uint16_t i = 0; i < w; i++) {
+        _frame[(y + j) * _width + x + i] = *img++;
+      }
+    }
+  }
+
+  /*!
+      @brief  Counts the VSCRSADD command AVR_ILI9341::scrollTo() sends. The
+              frame memory is not scrolled.
+      @param  y  First line of the scrolling area shown.
+  */
+  void scrollTo(uint16_t y) {
+    (void)y;
+    _spiBytes += 3;
+  }
+
+  /*!
+      @brief  Fills the frame memory directly, bypassing the drawing code.
+      @param  color  16-bit pixel color in '565' RGB format.
+  */
+  void clear(uint16_t color) {
+    for (uint32_t i = 0; i < FRAME_PIXELS; i++) _frame[i] = color;
+  }
+
+  /*!
+      @brief  Sets the rotation, 0 to 3. The frame memory is kept as is, so
+              what is in it is only meaningful after clear().
+      @param  r  Rotation, odd ones are landscape.
+  */
+  void setRotation(uint8_t r) {
+    rotation = r & 3;
+    _width = rotation & 1 ? HOST_PANEL_HEIGHT : HOST_PANEL_WIDTH;
+    _height = rotation & 1 ? HOST_PANEL_WIDTH : HOST_PANEL_HEIGHT;
+  }
+
+  /*!
+      @brief  Returns a pixel of the frame memory.
+      @param  x  Column.
+      @param  y  Row.
+  */
+  uint16_t pixel(uint16_t x, uint16_t y) const {
+    return _frame[y * _width + x];
+  }
+
+  /*!
+      @brief  Returns the number of pixels written since construction.
+  */
+  uint64_t pixels(void) const { return _pixels; }
+
+  /*!
+      @brief  Returns the number of bytes the display would have been sent
+              since the last resetSPIBytes().
+  */
+  uint32_t spiBytes(void) const { return _spiBytes; }
+
+  /*!
+      @brief  Restarts the count of spiBytes().
+  */
+  void resetSPIBytes(void) { _spiBytes = 0; }
+
+  /*!
+      @brief  CRC-32 (zlib) of the frame, row by row and high byte first, as
+              examples/shape_capture.ino computes it from the real display.
+  */
+  uint32_t crc32(void) const {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < FRAME_PIXELS; i++) {
+      crc = crcByte(crc, _frame[i] >> 8);
+      crc = crcByte(crc, _frame[i] & 0xFF);
+    }
+    return ~crc;
+  }
+
+  /*!
+      @brief  Returns the first broken invariant, an empty string if none.
+  */
+  const char *error(void) const { return _error; }
+
+ private:
+  static uint32_t crcByte(uint32_t crc, uint8_t data) {
+    crc ^= data;
+    for (uint8_t i = 0; i < 8; i++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+    }
+    return crc;
+  }
+
+  void fail(const char *format, unsigned long a, unsigned long b = 0,
+            unsigned long c = 0, unsigned long d = 0) {
+    if (!_error[0]) snprintf(_error, sizeof(_error), format, a, b, c, d);
+  }
+
+  static const uint32_t FRAME_PIXELS =
+      (uint32_t)HOST_PANEL_WIDTH * HOST_PANEL_HEIGHT;
+
+  uint16_t _frame[FRAME_PIXELS];  ///< Frame memory, rows at the rotation.
+  uint16_t _x1, _y1, _x2, _y2;    ///< Current address window.
+  bool _open;                     ///< Window not ended by endWrite() yet.
+  uint64_t _pixels;               ///< Pixels written since construction.
+  uint32_t _spiBytes;             ///< Bytes the display would be sent.
+  char _error[96];                ///< First broken invariant.
+};
+
+#endif  // end _TFT_HOST_PANEL_H_
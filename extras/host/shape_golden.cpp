@@ -0,0 +1,105 @@
+/*!
+ * @file shape_golden.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+// Runs the drawShape() cases of examples/shape_cases.h on HostPanel and
+// prints the CSV of examples/shape_capture.ino, one CRC32 per frame, for
+// extras/golden_compare.py:
+//
+//   g++ -O2 -Iextras/host -Iutility -o shape_golden
+//       extras/host/shape_golden.cpp utility/TFT_GFX.cpp
+//   ./shape_golden --frames > run.txt
+//   python3 extras/golden_compare.py extras/host/shape_golden.txt.xz run.txt
+//       --diff diff/
+//
+// --frames precedes each case's CSV line with its frame, as the spans of
+// non-black pixels: "span,<y>,<x>,<count>,<hex color>". The reference,
+// extras/host/shape_golden.txt.xz, is this output compressed, so a changed
+// case is drawn against its reference frame. --dump <case> prints one frame
+// as the board does instead, "row,<y>,<hex pixels>" lines.
+// The exit status is 1 if a transfer broke HostPanel's window invariants.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../examples/shape_cases.h"
+#include "host_panel.h"
+
+static HostPanel panel;
+
+static void printSpans(void) {
+  for (uint16_t y = 0; y < HOST_PANEL_HEIGHT; y++) {
+    uint16_t x = 0;
+    while (x < HOST_PANEL_WIDTH) {
+      uint16_t color = panel.pixel(x, y);
+      uint16_t n = 1;
+      while (x + n < HOST_PANEL_WIDTH && panel.pixel(x + n, y) == color) n++;
+      if (color != 0) printf("span,%u,%u,%u,%04X\n", y, x, n, color);
+      x += n;
+    }
+  }
+}
+
+static void printRows(void) {
+  for (uint16_t y = 0; y < HOST_PANEL_HEIGHT; y++) {
+    printf("row,%u,", y);
+    for (uint16_t x = 0; x < HOST_PANEL_WIDTH; x++) {
+      printf("%04X", panel.pixel(x, y));
+    }
+    printf("\n");
+  }
+}
+
+int main(int argc, char **argv) {
+  bool frames = false;
+  long dump = -1;
+  if (argc == 2 && strcmp(argv[1], "--frames") == 0) {
+    frames = true;
+  } else if (argc == 3 && strcmp(argv[1], "--dump") == 0) {
+    dump = atol(argv[2]);
+  } else if (argc != 1) {
+    fprintf(stderr, "usage: %s [--frames | --dump <case>]\n", argv[0]);
+    return 2;
+  }
+
+  printf("case,x,y,length,breadth,radius,stroke,crc32\n");
+
+  for (uint16_t id = 0; id < SHAPE_CASES; id++) {
+    ShapeCase c = shapeCase(id);
+
+    panel.clear(0);
+    panel.drawShape(c.x, c.y, c.length, c.breadth, c.radius, c.stroke,
+                    SHAPE_STROKE, SHAPE_FILL);
+
+    if (frames) printSpans();
+    if (id == dump) printRows();
+    printf("%u,%u,%u,%u,%u,%u,%u,%lX\n", id, c.x, c.y, c.length, c.breadth,
+           c.radius, c.stroke, (unsigned long)panel.crc32());
+
+    if (panel.error()[0]) {
+      fprintf(stderr, "case %u: %s\n", id, panel.error());
+      return 1;
+    }
+  }
+
+  printf("done\n");
+  return 0;
+}
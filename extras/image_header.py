@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Converts an image to a C header for AVR_ILI9341::drawPixels_P().
+
+The pixels are stored in the display's byte order, '565' RGB with the most
+significant byte first, so they are sent to the display exactly as stored:
+
+    python3 extras/image_header.py logo.ppm --name logo -o logo.h
+
+Then in the sketch:
+
+    #include "logo.h"
+    tft.drawPixels_P(10, 10, LOGO_WIDTH, LOGO_HEIGHT, logo);
+
+Images are read as by asset_pack.py: binary PPM, or any format with Pillow.
+--ram writes an array for drawPixels() instead of PROGMEM.
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from asset_pack import read_image  # noqa: E402
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("image", help="image to convert")
+    parser.add_argument("--name", help="C name of the array, else the file's")
+    parser.add_argument("--ram", action="store_true",
+                        help="array in RAM for drawPixels(), not PROGMEM")
+    parser.add_argument("-o", "--output", help="header to write, else stdout")
+    args = parser.parse_args()
+
+    name = args.name
+    if not name:
+        name = os.path.splitext(os.path.basename(args.image))[0]
+        name = "".join(c if c.isalnum() else "_" for c in name)
+        if name[0].isdigit():
+            name = "_" + name
+    w, h, pixels = read_image(args.image)
+
+    out = [
+        "// Generated by extras/image_header.py from %s, do not edit." %
+        os.path.basename(args.image),
+        "",
+        "#include <Arduino.h>",
+        "",
+        "#define %s_WIDTH %d" % (name.upper(), w),
+        "#define %s_HEIGHT %d" % (name.upper(), h),
+        "",
+        "static const uint8_t %s[%d]%s = {" %
+        (name, 2 * w * h, "" if args.ram else " PROGMEM"),
+    ]
+    for i in range(0, len(pixels), 6):
+        row = pixels[i:i + 6]
+        out.append("    %s," % ", ".join("0x%02X, 0x%02X" % (p >> 8, p & 0xFF)
+                                         for p in row))
+    out += ["};", ""]
+    text = "\n".join(out)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Converts a TFT_Profile dump into a Chrome trace.
+
+TFT_Profile::dump() prints "time_us,id,B|E" lines (see TFT_Profile.h). Save
+the serial output and convert it:
+
+    python3 extras/profile_to_chrome.py dump.txt -o trace.json
+    python3 extras/profile_to_chrome.py dump.txt --names widgets.txt
+
+Open trace.json in chrome://tracing or https://ui.perfetto.dev. The names
+file maps the sketch's own IDs (from TFT_PROF_USER, 64) to names, one
+"<id>=<name>" per line. A summary of the total time per span is printed.
+"""
+
+import argparse
+import collections
+import json
+import sys
+
+NAMES = {
+    1: "fillScreen",
+    2: "drawShape",
+    3: "setAddressWindow",
+    4: "drawImage",
+    5: "readPixels",
+    6: "scrollTo",
+}
+
+
+def read_names(path):
+    names = dict(NAMES)
+    with open(path) as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if line:
+                key, name = line.split("=", 1)
+                names[int(key, 0)] = name.strip()
+    return names
+
+
+def read_events(path):
+    """Returns ([(time_us, id, phase)], dropped), time unwrapped."""
+    events, dropped = [], 0
+    offset, last = 0, None
+    with open(path) as f:
+        for line in f:
+            fields = line.strip().split(",")
+            if fields[0] == "dropped" and len(fields) == 2:
+                dropped += int(fields[1])
+            elif len(fields) == 3 and fields[0].isdigit() and \
+                    fields[2] in ("B", "E"):
+                time = int(fields[0])
+                if last is not None and time + offset < last:
+                    offset += 1 << 32  # micros() wrapped around.
+                last = time + offset
+                events.append((last, int(fields[1]), fields[2]))
+    return events, dropped
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump", help="serial output of TFT_Profile::dump()")
+    parser.add_argument("-o", "--output", default="trace.json")
+    parser.add_argument("--names", help="file of <id>=<name> lines")
+    args = parser.parse_args()
+
+    names = read_names(args.names) if args.names else NAMES
+    events, dropped = read_events(args.dump)
+    if not events:
+        sys.exit("no profile events found in " + args.dump)
+    if dropped:
+        print("warning: %d events were overwritten on the device" % dropped)
+
+    trace, stack = [], []
+    totals = collections.Counter()
+    calls = collections.Counter()
+    start = events[0][0]
+
+    for time, event_id, phase in events:
+        name = names.get(event_id, "id_%d" % event_id)
+        if phase == "B":
+            stack.append((event_id, time))
+        elif not stack or stack[-1][0] != event_id:
+            continue  # Exit of a span entered before the buffer's window.
+        else:
+            _, begin = stack.pop()
+            totals[name] += time - begin
+            calls[name] += 1
+        trace.append({"name": name, "ph": phase, "ts": time - start,
+                      "pid": 0, "tid": 0})
+
+    # Close the spans still open when the dump was taken.
+    for event_id, _ in reversed(stack):
+        trace.append({"name": names.get(event_id, "id_%d" % event_id),
+                      "ph": "E", "ts": events[-1][0] - start,
+                      "pid": 0, "tid": 0})
+
+    with open(args.output, "w") as f:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, f)
+
+    print("%-20s %8s %12s %10s" % ("span", "calls", "total us", "mean us"))
+    for name, total in totals.most_common():
+        print("%-20s %8d %12d %10.1f" %
+              (name, calls[name], total, float(total) / calls[name]))
+    print("trace written to %s" % args.output)
+
+
+if __name__ == "__main__":
+    main()
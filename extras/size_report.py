@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""Flash/RAM size report for each AVR_ILI9341 build configuration.
+
+Builds a sketch once per configuration defined in utility/TFT_Config.h with
+arduino-cli, runs avr-size over the resulting ELF and prints one row per
+configuration.
+
+    python3 extras/size_report.py examples/simple_test.ino
+    python3 extras/size_report.py --fqbn arduino:avr:mega --csv sketch.ino
+    python3 extras/size_report.py --markdown examples/simple_test.ino
+
+--markdown prints the table of the README's Configuration section. --config
+NAME=FLAGS, repeated, measures those builds instead of TFT_Config.h's, e.g.
+for examples/dispatch_size.ino.
+
+Both arduino-cli and avr-size (shipped with the arduino:avr core) must be on
+the PATH. Already captured avr-size outputs can be tabulated instead with
+--from-size NAME=FILE.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Name -> compiler flags. "full" is the default build.
+CONFIGS = [
+    ("full", []),
+    ("no-text", ["-DTFT_ENABLE_TEXT=0"]),
+    ("no-images", ["-DTFT_ENABLE_IMAGES=0"]),
+    ("no-readback", ["-DTFT_ENABLE_READBACK=0"]),
+    ("int-circles", ["-DTFT_ENABLE_FLOAT_MATH=0"]),
+    ("no-circles", ["-DTFT_ENABLE_CIRCLES=0", "-DTFT_ENABLE_FLOAT_MATH=0"]),
+    ("compact", ["-DTFT_COMPACT"]),
+]
+
+# Flash / RAM of the supported boards, in bytes.
+BOARDS = {
+    "arduino:avr:leonardo": (28672, 2560),  # 32 KB less the bootloader.
+    "arduino:avr:mega": (253952, 8192),
+}
+
+
+def parse_avr_size(output):
+    """Returns (text, data, bss) from avr-size's default berkeley output."""
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) >= 3 and all(f.isdigit() for f in fields[:3]):
+            return tuple(int(f) for f in fields[:3])
+    raise ValueError("no avr-size totals found in:\n" + output)
+
+
+def sketch_dir(sketch, work_dir):
+    """Copies the sketch and the headers beside it into a folder of its own
+    name, as arduino-cli wants: examples/ holds several sketches."""
+    src = os.path.dirname(os.path.abspath(sketch))
+    name = os.path.splitext(os.path.basename(sketch))[0]
+    dst = os.path.join(work_dir, name)
+    os.mkdir(dst)
+    shutil.copy(sketch, os.path.join(dst, name + ".ino"))
+    for header in os.listdir(src):
+        if header.endswith(".h"):
+            shutil.copy(os.path.join(src, header), dst)
+    return dst
+
+
+def build(sketch, fqbn, flags, work_dir):
+    """Compiles the sketch with the flags and returns its ELF file path."""
+    extra = " ".join(flags)
+    build_dir = os.path.join(work_dir, "build")
+    cmd = [
+        "arduino-cli", "compile", "--fqbn", fqbn,
+        "--build-path", build_dir,
+        "--build-property", "compiler.cpp.extra_flags=" + extra,
+        "--build-property", "compiler.c.extra_flags=" + extra,
+        sketch_dir(sketch, work_dir),
+    ]
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+    for name in os.listdir(build_dir):
+        if name.endswith(".elf"):
+            return os.path.join(build_dir, name)
+    raise RuntimeError("arduino-cli produced no ELF in " + build_dir)
+
+
+def measure(sketch, fqbn, flags):
+    work_dir = tempfile.mkdtemp(prefix="tft_size_")
+    try:
+        elf = build(sketch, fqbn, flags, work_dir)
+        out = subprocess.run(["avr-size", elf], check=True,
+                             capture_output=True, text=True).stdout
+        return parse_avr_size(out)
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+
+def report_markdown(rows, fqbn):
+    """Prints the rows as a Markdown table, with the board's share used."""
+    flash_max, ram_max = BOARDS.get(fqbn, (0, 0))
+    base = rows[0][1][0] + rows[0][1][1] if rows else 0
+
+    print("| Configuration | Flash | RAM | Flash vs %s |" % rows[0][0])
+    print("| --- | ---: | ---: | ---: |")
+    for name, (text, data, bss) in rows:
+        flash, ram = text + data, data + bss
+        flash_cell, ram_cell = "%d" % flash, "%d" % ram
+        if flash_max:
+            flash_cell += " (%.0f%%)" % (100.0 * flash / flash_max)
+            ram_cell += " (%.0f%%)" % (100.0 * ram / ram_max)
+        print("| `%s` | %s | %s | %+d |" %
+              (name, flash_cell, ram_cell, flash - base))
+
+
+def report(rows, fqbn, csv):
+    flash_max, ram_max = BOARDS.get(fqbn, (0, 0))
+    base = rows[0][1][0] + rows[0][1][1] if rows else 0
+
+    if csv:
+        print("config,text,data,bss,flash,ram,flash_delta")
+    else:
+        print("%-12s %8s %6s %6s %8s %6s %8s" %
+              ("config", "text", "data", "bss", "flash", "ram", "delta"))
+
+    for name, (text, data, bss) in rows:
+        flash, ram = text + data, data + bss
+        if csv:
+            print("%s,%d,%d,%d,%d,%d,%d" %
+                  (name, text, data, bss, flash, ram, flash - base))
+            continue
+        pct = ""
+        if flash_max:
+            pct = "  (%.1f%% flash, %.1f%% ram)" % (
+                100.0 * flash / flash_max, 100.0 * ram / ram_max)
+        print("%-12s %8d %6d %6d %8d %6d %+8d%s" %
+              (name, text, data, bss, flash, ram, flash - base, pct))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("sketch", nargs="?", help="sketch .ino to build")
+    parser.add_argument("--fqbn", default="arduino:avr:leonardo")
+    parser.add_argument("--csv", action="store_true", help="CSV output")
+    parser.add_argument("--markdown", action="store_true",
+                        help="Markdown table output, for the README")
+    parser.add_argument("--config", action="append", default=[],
+                        metavar="NAME=FLAGS",
+                        help="build with these flags instead of the "
+                        "TFT_Config.h configurations")
+    parser.add_argument("--from-size", action="append", default=[],
+                        metavar="NAME=FILE",
+                        help="tabulate a saved avr-size output instead")
+    args = parser.parse_args()
+
+    rows = []
+    if args.from_size:
+        for item in args.from_size:
+            name, path = item.split("=", 1)
+            with open(path) as f:
+                rows.append((name, parse_avr_size(f.read())))
+    elif args.sketch:
+        configs = CONFIGS
+        if args.config:
+            configs = [(item.split("=", 1)[0], item.split("=", 1)[1].split())
+                       for item in args.config]
+        for name, flags in configs:
+            print("building %s..." % name, file=sys.stderr)
+            rows.append((name, measure(args.sketch, args.fqbn, flags)))
+    else:
+        parser.error("a sketch or --from-size is required")
+
+    if args.markdown:
+        report_markdown(rows, args.fqbn)
+    else:
+        report(rows, args.fqbn, args.csv)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""Replays a TFT_Trace recording on an emulated ILI9341.
+
+Decodes a trace written by utility/TFT_Trace (see TFT_Trace.h for the format),
+runs it through a model of the ILI9341 memory write path and reports the
+command mix. The panel contents at the end of the trace, or after any
+transaction, can be written as a PPM image to reproduce rendering bugs.
+
+    python3 extras/trace_replay.py TRACE.BIN
+    python3 extras/trace_replay.py TRACE.BIN --image screen.ppm
+    python3 extras/trace_replay.py TRACE.BIN --image frame.ppm --stop-at 120
+
+The model covers CASET, PASET, RAMWR, RAMWR continue, MADCTL and vertical
+scrolling, which is all the library draws with. Other commands are counted
+but otherwise ignored.
+"""
+
+import argparse
+import collections
+import sys
+
+SELECT, DESELECT, COMMAND, DATA, RUN, READ, LOST = range(1, 8)
+
+WIDTH, HEIGHT = 240, 320  # Panel GRAM, native orientation.
+
+NAMES = {
+    0x01: "SWRESET", 0x11: "SLPOUT", 0x13: "NORON", 0x20: "INVOFF",
+    0x21: "INVON", 0x26: "GAMMASET", 0x28: "DISPOFF", 0x29: "DISPON",
+    0x2A: "CASET", 0x2B: "PASET", 0x2C: "RAMWR", 0x2E: "RAMRD",
+    0x33: "VSCRDEF", 0x36: "MADCTL", 0x37: "VSCRSADD", 0x3A: "PIXFMT",
+    0x3C: "RAMWRC", 0x51: "WRDISBV", 0x53: "WRCTRLD", 0x55: "WRCABC",
+    0xB1: "FRMCTR1", 0xB6: "DFUNCTR", 0xC0: "PWCTR1", 0xC1: "PWCTR2",
+    0xC5: "VMCTR1", 0xC7: "VMCTR2", 0xD9: "INDEX", 0xE0: "GMCTRP1",
+    0xE1: "GMCTRN1",
+}
+
+
+def read_records(data):
+    """Yields (tag, args) records from the trace bytes."""
+    if data[:4] != b"TFTR":
+        sys.exit("not a TFT_Trace file")
+    if data[4] not in (1, 2):
+        sys.exit("unsupported trace version %d" % data[4])
+    pos = 5
+
+    def count():
+        nonlocal pos
+        value, shift = 0, 0
+        while True:
+            byte = data[pos]
+            pos += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+    while pos < len(data):
+        tag = data[pos]
+        pos += 1
+        if tag in (SELECT, DESELECT):
+            yield tag, ()
+        elif tag in (COMMAND, DATA):
+            yield tag, (data[pos],)
+            pos += 1
+        elif tag == RUN:
+            value = (data[pos] << 8) | data[pos + 1]
+            pos += 2
+            yield tag, (value, count())
+        elif tag in (READ, LOST):
+            yield tag, (count(),)
+        else:
+            sys.exit("corrupt trace: tag 0x%02X at offset %d" % (tag, pos - 1))
+
+
+class Panel:
+    """ILI9341 memory write path."""
+
+    def __init__(self):
+        self.gram = [[0] * WIDTH for _ in range(HEIGHT)]
+        self.madctl = 0x48
+        self.cols = [0, WIDTH - 1]
+        self.pages = [0, HEIGHT - 1]
+        self.scroll = (0, HEIGHT, 0)  # Top, scroll and bottom areas.
+        self.scroll_start = 0
+        self.cmd = None
+        self.params = []
+        self.pending = None  # High byte of a pixel split across records.
+        self.col = self.page = 0
+
+    def command(self, cmd):
+        self.cmd = cmd
+        self.params = []
+        self.pending = None
+        if cmd == 0x2C:  # RAMWR restarts at the window's top-left corner.
+            self.col, self.page = self.cols[0], self.pages[0]
+
+    def data(self, byte):
+        if self.cmd in (0x2C, 0x3C):
+            if self.pending is None:
+                self.pending = byte
+            else:
+                self.pixel((self.pending << 8) | byte)
+                self.pending = None
+            return
+
+        self.params.append(byte)
+        p = self.params
+        if self.cmd == 0x2A and len(p) == 4:
+            self.cols = [(p[0] << 8) | p[1], (p[2] << 8) | p[3]]
+        elif self.cmd == 0x2B and len(p) == 4:
+            self.pages = [(p[0] << 8) | p[1], (p[2] << 8) | p[3]]
+        elif self.cmd == 0x36 and len(p) == 1:
+            self.madctl = p[0]
+        elif self.cmd == 0x33 and len(p) == 6:
+            self.scroll = ((p[0] << 8) | p[1], (p[2] << 8) | p[3],
+                           (p[4] << 8) | p[5])
+        elif self.cmd == 0x37 and len(p) == 2:
+            self.scroll_start = (p[0] << 8) | p[1]
+
+    def run(self, value, count):
+        if self.cmd in (0x2C, 0x3C) and self.pending is None:
+            for _ in range(count):
+                self.pixel(value)
+        else:
+            for _ in range(count):
+                self.data(value >> 8)
+                self.data(value & 0xFF)
+
+    def pixel(self, value):
+        mv = self.madctl & 0x20
+        # Rotation 0 (MX set) is the upright portrait orientation.
+        mx = not self.madctl & 0x40
+        my = self.madctl & 0x80
+        max_col, max_page = (HEIGHT, WIDTH) if mv else (WIDTH, HEIGHT)
+
+        c, p = self.col, self.page
+        if c < max_col and p < max_page:
+            if mx:
+                c = max_col - 1 - c
+            if my:
+                p = max_page - 1 - p
+            x, y = (p, c) if mv else (c, p)
+            self.gram[y][x] = value
+
+        # Advance along the window, wrapping to its next row.
+        self.col += 1
+        if self.col > self.cols[1]:
+            self.col = self.cols[0]
+            self.page += 1
+            if self.page > self.pages[1]:
+                self.page = self.pages[0]
+
+    def screen(self):
+        """Returns the GRAM rows in display order, scrolling applied."""
+        top, area, _ = self.scroll
+        rows = []
+        for r in range(HEIGHT):
+            src = r
+            if top <= r < top + area and area > 0:
+                src = top + (r - top + self.scroll_start - top) % area
+            rows.append(self.gram[src % HEIGHT])
+        return rows
+
+    def write_ppm(self, path):
+        out = bytearray()
+        for row in self.screen():
+            for v in row:
+                r, g, b = (v >> 11) & 0x1F, (v >> 5) & 0x3F, v & 0x1F
+                out += bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4),
+                              (b << 3) | (b >> 2)))
+        with open(path, "wb") as f:
+            f.write(b"P6\n%d %d\n255\n" % (WIDTH, HEIGHT))
+            f.write(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("trace", help="trace file written by TFT_Trace")
+    parser.add_argument("--image", metavar="PPM",
+                        help="write the panel contents as a PPM image")
+    parser.add_argument("--stop-at", type=int, metavar="N",
+                        help="stop after the N-th transaction")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as f:
+        data = f.read()
+
+    panel = Panel()
+    commands = collections.Counter()
+    payload = collections.Counter()  # Data bytes sent after each command.
+    transactions = reads = 0
+    lost = []  # Transactions that outgrew the trace buffer.
+
+    for tag, rec in read_records(data):
+        if tag == SELECT:
+            transactions += 1
+        elif tag == DESELECT:
+            if args.stop_at and transactions >= args.stop_at:
+                break
+        elif tag == COMMAND:
+            commands[rec[0]] += 1
+            panel.command(rec[0])
+        elif tag == DATA:
+            payload[panel.cmd] += 1
+            panel.data(rec[0])
+        elif tag == RUN:
+            payload[panel.cmd] += 2 * rec[1]
+            panel.run(rec[0], rec[1])
+        elif tag == READ:
+            reads += rec[0]
+        elif tag == LOST:
+            lost.append((transactions, rec[0]))
+
+    total = sum(commands.values()) + sum(payload.values()) + reads
+    print("trace: %d bytes for %d bytes on the bus, %d transactions" %
+          (len(data), total, transactions))
+    print("%-10s %8s %10s %6s" % ("command", "count", "data bytes", "bus %"))
+    for cmd, n in commands.most_common():
+        name = NAMES.get(cmd, "0x%02X" % cmd)
+        share = 100.0 * (n + payload[cmd]) / total if total else 0
+        print("%-10s %8d %10d %5.1f%%" % (name, n, payload[cmd], share))
+    if reads:
+        print("%-10s %8s %10d %5.1f%%" % ("reads", "", reads,
+                                           100.0 * reads / total))
+
+    for n, records in lost:
+        print("transaction %d: %d records lost, raise TFT_TRACE_BUFFER or "
+              "trace to an output off the SPI bus unbuffered" % (n, records))
+
+    if args.image:
+        panel.write_ppm(args.image)
+        print("panel contents written to %s" % args.image)
+
+
+if __name__ == "__main__":
+    main()
@@ -32,6 +32,10 @@ POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "Adafruit_GFX.h"
+#include "TFT_Color.h"
+
+// The legacy text/Processing API is only compiled with TFT_ENABLE_TEXT.
+#if TFT_ENABLE_TEXT
 #include "glcdfont.c"
 #ifdef ARDUINO_ARCH_AVR
 #include <avr/pgmspace.h>
@@ -506,7 +510,7 @@ int16_t Adafruit_GFX::height(void)
 
 uint16_t Adafruit_GFX::newColor(uint8_t r, uint8_t g, uint8_t b) 
 {
-  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  return TFT_Color::rgb565(r, g, b);
 }
 
 void Adafruit_GFX::background(uint8_t red, uint8_t green, uint8_t blue) 
@@ -655,7 +659,7 @@ void Adafruit_GFX::triangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int1
   }
 }
 
-#if defined(__SD_H__)  // Arduino SD library
+#if defined(__SD_H__) && TFT_ENABLE_IMAGES  // Arduino SD library
 
 #define BUFFPIXEL 20
 
@@ -713,3 +717,5 @@ void Adafruit_GFX::image(PImage & img, uint16_t x, uint16_t y) {
 }
 
 #endif
+
+#endif  // TFT_ENABLE_TEXT
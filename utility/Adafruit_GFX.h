@@ -54,7 +54,9 @@
  * 
  */
 
-#if defined(__SD_H__)  // Arduino SD library
+#include "TFT_Config.h"
+
+#if defined(__SD_H__) && TFT_ENABLE_IMAGES  // Arduino SD library
  #include "PImage.h"
 #else
 //  #warning "The SD library was not found. loadImage() and image() won't be supported."
@@ -190,7 +192,7 @@ rect(int16_t x, int16_t y, int16_t width, int16_t height),
   void popStyle();
   */
 
-#if defined(__SD_H__)  // Arduino SD library
+#if defined(__SD_H__) && TFT_ENABLE_IMAGES  // Arduino SD library
   PImage loadImage(const char * fileName) { return PImage::loadImage(fileName); }
   
   void image(PImage & img, uint16_t x, uint16_t y);
@@ -220,7 +222,7 @@ rect(int16_t x, int16_t y, int16_t width, int16_t height),
   bool useFill;
 };
 
-#if defined(__SD_H__)  // Arduino SD library
+#if defined(__SD_H__) && TFT_ENABLE_IMAGES  // Arduino SD library
 
 #define BUFFPIXEL 20
 
@@ -0,0 +1,462 @@
+/*!
+ * @file TFT_Assets.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_ASSETS_H_
+#define _TFT_ASSETS_H_
+
+#include "TFT_SPI.h"
+
+#if TFT_ENABLE_IMAGES
+
+#ifndef TFT_ASSET_BUFFER
+#define TFT_ASSET_BUFFER 512  ///< Stack buffer of the blits, an SD sector.
+#endif
+
+#define TFT_ASSET_VERSION 1  ///< Version of the pack format read.
+
+// Pack layout written by extras/asset_pack.py, header and index little-endian:
+//   header  "TFTA", version u8, 0 u8, count u16, index offset u32, 0 u32
+//   index   count entries sorted by id: id u16, type u8, 0 u8, offset u32,
+//           size u32
+// Asset data, pixels big-endian 565 as sent to the display:
+//   RAW     w u16, h u16, w * h pixels
+//   RLE     w u16, h u16, then runs: n < 128 is n + 1 literal pixels,
+//           n >= 128 is n - 127 copies of the next pixel
+//   PAL     w u16, h u16, bpp u8 (1, 2 or 4), colors u8, colors pixels,
+//           then rows of bpp bit indices, most significant first, each
+//           row padded to a byte
+//   FONT    first u8, last u8, height u8, 0 u8, then per glyph width u8,
+//           0 u8, bitmap offset u16, then the glyphs as 1 bpp rows
+#define TFT_ASSET_RAW 1   ///< Uncompressed bitmap.
+#define TFT_ASSET_RLE 2   ///< Run-length encoded bitmap.
+#define TFT_ASSET_PAL 3   ///< Palette bitmap, up to 16 colors.
+#define TFT_ASSET_FONT 4  ///< 1 bpp proportional font.
+
+/*!
+  @brief  An asset's entry in the pack index.
+*/
+struct TFT_Asset {
+  uint16_t id;      ///< Asset ID, the index is sorted on it.
+  uint8_t type;     ///< One of the TFT_ASSET_* types.
+  uint32_t offset;  ///< File offset of the asset data.
+  uint32_t size;    ///< Size of the asset data in bytes.
+};
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_AssetPack draws the bitmaps and fonts of an asset pack built by
+          extras/asset_pack.py. Assets are found by a binary search over the
+          index on the card and streamed into the `Device`'s address window
+          (e.g. AVR_ILI9341) through a TFT_ASSET_BUFFER bytes stack buffer,
+          never whole into RAM. `FileT` is any file class with seek() and
+          read(), usually the SD library's File.
+
+          The card usually shares the SPI bus with the display: the display's
+          transaction is ended for every read and the write resumed after it
+          with the device's continueWrite().
+
+  @code
+    File file = SD.open("ASSETS.BIN");
+    TFT_AssetPack<AVR_ILI9341, File> assets(tft, file);
+
+    if (assets.begin()) {
+      assets.drawBitmap(ICON_HOME, 10, 10);
+      assets.drawText(FONT_SMALL, 10, 50, "Home", ILI9341_WHITE, 0);
+    }
+  @endcode
+*/
+template <class Device, class FileT>
+class TFT_AssetPack {
+ public:
+  /*!
+      @brief  Binds the pack to a display and an open pack file.
+      @param  dev  The device drawn on.
+      @param  file  The pack file, kept open while the pack is used.
+  */
+  TFT_AssetPack(Device &dev, FileT &file)
+      : _dev(dev), _file(file), _count(0), _index(0) {}
+
+  bool begin(void);
+  bool find(uint16_t id, TFT_Asset *asset);
+  bool getSize(uint16_t id, uint16_t *w, uint16_t *h);
+  bool drawBitmap(uint16_t id, uint16_t x, uint16_t y);
+  uint16_t drawText(uint16_t fontId, uint16_t x, uint16_t y, const char *text,
+                    uint16_t fg, uint16_t bg);
+
+ private:
+  /*!
+    @brief  Sequential reader over a part of the file, feeding the display.
+  */
+  struct Stream {
+    uint8_t *buf;   ///< TFT_ASSET_BUFFER bytes buffer.
+    uint16_t len;   ///< Bytes in the buffer.
+    uint16_t pos;   ///< Next byte of the buffer.
+    uint32_t next;  ///< File offset of the byte after the buffer.
+    uint32_t end;   ///< File offset after the last byte readable.
+    bool open;      ///< The display window has been opened.
+    bool failed;    ///< A read failed or went past the end.
+  };
+
+  bool readAt(uint32_t pos, void *dst, uint16_t len);
+  bool fill(Stream &s);
+  uint8_t next(Stream &s);
+  bool openWindow(Stream &s, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void drawRaw(Stream &s, uint32_t num);
+  void drawRLE(Stream &s, uint32_t num);
+  void drawIndexed(Stream &s, uint16_t w, uint16_t h, uint8_t bpp,
+                   const uint16_t *palette);
+
+  static uint16_t le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+  static uint32_t le32(const uint8_t *p) {
+    return le16(p) | ((uint32_t)le16(p + 2) << 16);
+  }
+
+  Device &_dev;     ///< Device drawn on.
+  FileT &_file;     ///< Pack file.
+  uint16_t _count;  ///< Assets in the pack.
+  uint32_t _index;  ///< File offset of the index.
+};
+
+/*!
+    @brief  Reads and checks the pack header.
+    @return false if the file isn't an asset pack of a supported version.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::begin(void) {
+  uint8_t header[16];
+  if (!readAt(0, header, sizeof(header))) return false;
+  if (memcmp(header, "TFTA", 4) != 0 || header[4] != TFT_ASSET_VERSION)
+    return false;
+
+  _count = le16(header + 6);
+  _index = le32(header + 8);
+  return true;
+}
+
+/*!
+    @brief  Looks an asset up with a binary search over the index, reading
+            one 12-byte entry per step.
+    @param  id  Asset ID.
+    @param  asset  Receives the asset's index entry.
+    @return false if the pack has no such asset.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::find(uint16_t id, TFT_Asset *asset) {
+  uint16_t low = 0, high = _count;
+  uint8_t entry[12];
+
+  while (low < high) {
+    uint16_t mid = low + (high - low) / 2;
+    if (!readAt(_index + 12UL * mid, entry, sizeof(entry))) return false;
+
+    uint16_t midId = le16(entry);
+    if (midId < id) {
+      low = mid + 1;
+    } else if (midId > id) {
+      high = mid;
+    } else {
+      asset->id = id;
+      asset->type = entry[2];
+      asset->offset = le32(entry + 4);
+      asset->size = le32(entry + 8);
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+    @brief  Reads the size of a bitmap asset.
+    @param  id  Asset ID.
+    @param  w  Receives the width in pixels.
+    @param  h  Receives the height in pixels.
+    @return false if the pack has no such bitmap.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::getSize(uint16_t id, uint16_t *w,
+                                           uint16_t *h) {
+  TFT_Asset asset;
+  uint8_t size[4];
+  if (!find(id, &asset) || asset.type == TFT_ASSET_FONT) return false;
+  if (!readAt(asset.offset, size, sizeof(size))) return false;
+
+  *w = le16(size);
+  *h = le16(size + 2);
+  return true;
+}
+
+/*!
+    @brief  Draws a bitmap asset with its top-left corner at (x, y).
+            Bitmaps not fully on the display are skipped.
+    @param  id  Asset ID.
+    @param  x  Display column of the top-left corner.
+    @param  y  Display row of the top-left corner.
+    @return false if the pack has no such bitmap, it doesn't fit on the
+            display or the file couldn't be read to its end.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::drawBitmap(uint16_t id, uint16_t x,
+                                              uint16_t y) {
+  TFT_Asset asset;
+  if (!find(id, &asset) || asset.type == TFT_ASSET_FONT) return false;
+
+  uint8_t buf[TFT_ASSET_BUFFER];
+  Stream s = {buf, 0, 0, asset.offset, asset.offset + asset.size, false,
+              false};
+
+  uint16_t w = next(s);
+  w |= next(s) << 8;
+  uint16_t h = next(s);
+  h |= next(s) << 8;
+
+  if (asset.type == TFT_ASSET_PAL) {
+    uint8_t bpp = next(s);
+    uint8_t colors = next(s);
+    uint16_t palette[16] = {0};
+    if (colors > 16 || (bpp != 1 && bpp != 2 && bpp != 4)) return false;
+
+    for (uint8_t i = 0; i < colors; i++) {
+      palette[i] = next(s) << 8;
+      palette[i] |= next(s);
+    }
+    if (!openWindow(s, x, y, w, h)) return false;
+    drawIndexed(s, w, h, bpp, palette);
+  } else {
+    // Whole pixels per read: pixel data must start at an even offset.
+    if (asset.type == TFT_ASSET_RAW && (asset.offset & 1)) return false;
+    if (!openWindow(s, x, y, w, h)) return false;
+
+    if (asset.type == TFT_ASSET_RAW) drawRaw(s, (uint32_t)w * h);
+    if (asset.type == TFT_ASSET_RLE) drawRLE(s, (uint32_t)w * h);
+  }
+
+  _dev.endWrite();
+  return !s.failed;
+}
+
+/*!
+    @brief  Draws a line of text with a font asset, the glyphs' background
+            included. Characters the font lacks are skipped, the text stops
+            at the first glyph not fitting on the display.
+    @param  fontId  Asset ID of the font.
+    @param  x  Display column of the text's top-left corner.
+    @param  y  Display row of the text's top-left corner.
+    @param  text  The text to draw.
+    @param  fg  Color of the glyphs.
+    @param  bg  Color of the glyphs' background.
+    @return The display column after the last glyph drawn.
+*/
+template <class Device, class FileT>
+uint16_t TFT_AssetPack<Device, FileT>::drawText(uint16_t fontId, uint16_t x,
+                                                uint16_t y, const char *text,
+                                                uint16_t fg, uint16_t bg) {
+  TFT_Asset font;
+  uint8_t header[4];
+  if (!find(fontId, &font) || font.type != TFT_ASSET_FONT) return x;
+  if (!readAt(font.offset, header, sizeof(header))) return x;
+
+  uint8_t first = header[0], last = header[1], height = header[2];
+  uint32_t bitmaps = font.offset + 4 + 4UL * (last - first + 1);
+  uint16_t palette[2] = {bg, fg};
+  uint8_t buf[TFT_ASSET_BUFFER];
+
+  for (; *text; text++) {
+    uint8_t c = *text;
+    uint8_t glyph[4];
+    if (c < first || c > last) continue;
+    if (!readAt(font.offset + 4 + 4 * (c - first), glyph, sizeof(glyph)))
+      break;
+
+    uint8_t w = glyph[0];
+    uint32_t start = bitmaps + le16(glyph + 2);
+    Stream s = {buf, 0, 0, start, start + ((w + 7) / 8) * height, false,
+                false};
+
+    if (w == 0) continue;
+    if (!openWindow(s, x, y, w, height)) break;
+    drawIndexed(s, w, height, 1, palette);
+    _dev.endWrite();
+    x += w;
+  }
+  return x;
+}
+
+/*!
+    @brief  Reads bytes at a file offset. No display window may be open.
+    @param  pos  File offset.
+    @param  dst  Receives the bytes.
+    @param  len  Number of bytes to read.
+    @return false if the file is shorter.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::readAt(uint32_t pos, void *dst,
+                                          uint16_t len) {
+  if (!_file.seek(pos)) return false;
+  return _file.read((uint8_t *)dst, len) == len;
+}
+
+/*!
+    @brief  Refills the stream's buffer. The display's transaction is ended
+            for the read and resumed after it. Reads end on multiples of
+            TFT_ASSET_BUFFER in the file, on sector boundaries by default.
+    @param  s  The stream.
+    @return false if nothing could be read.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::fill(Stream &s) {
+  uint32_t n = TFT_ASSET_BUFFER - s.next % TFT_ASSET_BUFFER;
+  if (n > s.end - s.next) n = s.end - s.next;
+
+  if (s.open) _dev.endWrite();  // The card may share the bus.
+  bool ok = n > 0 && readAt(s.next, s.buf, n);
+  if (s.open) _dev.continueWrite();
+
+  if (!ok) {
+    s.failed = true;
+    return false;
+  }
+  s.len = n;
+  s.pos = 0;
+  s.next += n;
+  return true;
+}
+
+/*!
+    @brief  Reads the stream's next byte.
+    @param  s  The stream.
+    @return The byte, 0 past the end where the stream is flagged failed.
+*/
+template <class Device, class FileT>
+uint8_t TFT_AssetPack<Device, FileT>::next(Stream &s) {
+  if (s.pos == s.len && !fill(s)) return 0;
+  return s.buf[s.pos++];
+}
+
+/*!
+    @brief  Opens the display window of a bitmap or glyph.
+    @return false if the window isn't fully on the display.
+*/
+template <class Device, class FileT>
+bool TFT_AssetPack<Device, FileT>::openWindow(Stream &s, uint16_t x,
+                                              uint16_t y, uint16_t w,
+                                              uint16_t h) {
+  if (w == 0 || h == 0 || x + w > _dev.width() || y + h > _dev.height())
+    return false;
+
+  _dev.setAddressWindow(x, y, x + w - 1, y + h - 1);
+  s.open = true;
+  return true;
+}
+
+/*!
+    @brief  Sends uncompressed pixels straight from the buffer.
+    @param  s  The stream, at the first pixel.
+    @param  num  Number of pixels.
+*/
+template <class Device, class FileT>
+void TFT_AssetPack<Device, FileT>::drawRaw(Stream &s, uint32_t num) {
+  while (num > 0) {
+    if (s.pos == s.len && !fill(s)) return;
+
+    uint32_t n = (s.len - s.pos) / 2;
+    if (n == 0) {
+      s.failed = true;  // A pixel split by the end of the data.
+      return;
+    }
+    if (n > num) n = num;
+    _dev.writePixels(s.buf + s.pos, n);
+    s.pos += 2 * n;
+    num -= n;
+  }
+}
+
+/*!
+    @brief  Decodes run-length encoded pixels, each run in one write.
+    @param  s  The stream, at the first run.
+    @param  num  Number of pixels.
+*/
+template <class Device, class FileT>
+void TFT_AssetPack<Device, FileT>::drawRLE(Stream &s, uint32_t num) {
+  while (num > 0 && !s.failed) {
+    uint8_t code = next(s);
+    uint16_t n = (code & 0x7F) + 1;
+    if (n > num) n = num;
+    num -= n;
+
+    if (code & 0x80) {
+      uint16_t color = next(s) << 8;
+      color |= next(s);
+      _dev.writeData16(color, n);
+      continue;
+    }
+
+    while (n-- > 0) {
+      uint16_t color = next(s) << 8;
+      color |= next(s);
+      _dev.writeData16(color, 1);
+    }
+  }
+}
+
+/*!
+    @brief  Decodes palette indices, writing each run of equal colors at
+            once, across rows too.
+    @param  s  The stream, at the first row.
+    @param  w  Width in pixels.
+    @param  h  Height in pixels.
+    @param  bpp  Bits per index: 1, 2 or 4.
+    @param  palette  Colors of the indices.
+*/
+template <class Device, class FileT>
+void TFT_AssetPack<Device, FileT>::drawIndexed(Stream &s, uint16_t w,
+                                               uint16_t h, uint8_t bpp,
+                                               const uint16_t *palette) {
+  uint8_t mask = (1 << bpp) - 1;
+  uint16_t color = 0;
+  uint32_t run = 0;
+
+  for (uint16_t row = 0; row < h && !s.failed; row++) {
+    uint8_t bits = 0, left = 0;
+
+    for (uint16_t col = 0; col < w; col++) {
+      if (left == 0) {
+        bits = next(s);
+        left = 8;
+      }
+      left -= bpp;
+      uint16_t pixel = palette[(bits >> left) & mask];
+
+      if (run > 0 && pixel != color) {
+        _dev.writeData16(color, run);
+        run = 0;
+      }
+      color = pixel;
+      run++;
+    }
+  }
+  if (run > 0) _dev.writeData16(color, run);
+}
+
+#endif  // TFT_ENABLE_IMAGES
+
+#endif  // end _TFT_ASSETS_H_
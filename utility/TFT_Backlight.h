@@ -0,0 +1,264 @@
+/*!
+ * @file TFT_Backlight.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_BACKLIGHT_H_
+#define _TFT_BACKLIGHT_H_
+
+#include "TFT_SPI.h"
+
+#ifndef TFT_BACKLIGHT_STEP_MS
+#define TFT_BACKLIGHT_STEP_MS 10  ///< Fade output updates, at most 100 Hz.
+#endif
+
+#ifndef TFT_BACKLIGHT_WAKE_MS
+#define TFT_BACKLIGHT_WAKE_MS 150  ///< Fade back up after activity().
+#endif
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Backlight drives the backlight, the largest power draw of the
+          module, through a perceptual brightness curve: levels are CIE
+          lightness steps mapped to PWM duty cycles, so level 128 looks half
+          as bright and fades look even. The duty goes either to a board pin
+          with analogWrite() or, when the module wires its backlight driver
+          to the display's LEDPWM output, to the display's Write Display
+          Brightness register (Device::setBrightness()).
+
+          Fades and the dimming after an idle time run from service(), which
+          never blocks; call activity() on user input to brighten again.
+
+  @code
+    TFT_Backlight<AVR_ILI9341> backlight(tft, BACKLIGHT);  // A PWM pin.
+
+    backlight.begin(0);
+    backlight.fadeTo(200, 500);              // Fade in over half a second.
+    backlight.setIdleDim(30000, 24, 2000);   // Dim after 30 s without input.
+
+    void loop() {
+      if (touch.touched()) backlight.activity();
+      backlight.service();
+    }
+  @endcode
+*/
+template <class Device>
+class TFT_Backlight {
+ public:
+  /*!
+      @brief  Binds the backlight to a display.
+      @param  dev  The display, used when pin is -1.
+      @param  pin  PWM pin # driving the backlight, -1 for the display's
+                   LEDPWM output.
+  */
+  TFT_Backlight(Device &dev, int8_t pin = -1)
+      : _dev(dev), _pin(pin), _level(0), _from(0), _target(0), _active(0),
+        _fadeMs(0), _fadeStart(0), _lastStep(0), _idleMs(0), _idleLevel(0),
+        _idleFadeMs(0), _lastActive(0), _dimmed(false) {}
+
+  void begin(uint8_t level = 255);
+  void setLevel(uint8_t level);
+  void fadeTo(uint8_t level, uint16_t ms);
+  void setIdleDim(uint32_t timeoutMs, uint8_t level = 32,
+                  uint16_t fadeMs = 1000);
+  void activity(void);
+  bool service(void);
+
+  /*!
+      @brief  Returns the level shown now, mid-fade or not.
+      @return Perceptual level, 0 to 255.
+  */
+  uint8_t level(void) const { return _level; }
+
+  /*!
+      @brief  Tells whether a fade is in progress.
+      @return true until the level reaches its target.
+  */
+  bool fading(void) const { return _level != _target; }
+
+  /*!
+      @brief  Tells whether the backlight was dimmed for lack of activity.
+      @return true from the idle dim until activity().
+  */
+  bool dimmed(void) const { return _dimmed; }
+
+  static constexpr uint8_t duty(uint8_t level);
+
+ private:
+  void start(uint8_t level, uint16_t ms);
+  void write(uint8_t level);
+
+  Device &_dev;           ///< Display, for the LEDPWM output.
+  int8_t _pin;            ///< PWM pin #, -1 for LEDPWM.
+  uint8_t _level;         ///< Level shown.
+  uint8_t _from;          ///< Level the fade started from.
+  uint8_t _target;        ///< Level the fade ends at.
+  uint8_t _active;        ///< Level when not dimmed.
+  uint16_t _fadeMs;       ///< Fade duration.
+  uint32_t _fadeStart;    ///< millis() at the start of the fade.
+  uint32_t _lastStep;     ///< millis() at the last output update.
+  uint32_t _idleMs;       ///< Idle time before dimming, 0 never.
+  uint8_t _idleLevel;     ///< Level when dimmed.
+  uint16_t _idleFadeMs;   ///< Fade down duration.
+  uint32_t _lastActive;   ///< millis() at the last activity().
+  bool _dimmed;           ///< Dimmed for lack of activity.
+};
+
+/*!
+    @brief  Converts a perceptual level to a PWM duty cycle with the CIE 1931
+            lightness curve, in integer math so constant levels are folded
+            at compile time.
+    @param  level  Lightness L* scaled from 0-100 to 0-255.
+    @return Duty cycle, 0 to 255, proportional to the luminance.
+*/
+template <class Device>
+constexpr uint8_t TFT_Backlight<Device>::duty(uint8_t level) {
+  // L* <= 8 is linear, Y = L* / 903.3; above, Y = ((L* + 16) / 116)^3,
+  // where (L* + 16) / 116 = (5 * level + 204) / 1479 fits 32-bit cubes.
+  return level <= 20 ? (level * 1000UL + 4516) / 9033
+                     : ((5UL * level + 204) * (5UL * level + 204) *
+                            (5UL * level + 204) +
+                        6343579) /
+                           12687158;  // 1479^3 / 255, half for rounding.
+}
+
+/*!
+    @brief  Configures the pin and sets the starting level.
+    @param  level  Perceptual level, 0 to 255.
+*/
+template <class Device>
+void TFT_Backlight<Device>::begin(uint8_t level) {
+  if (_pin >= 0) pinMode(_pin, OUTPUT);
+  _lastActive = millis();
+  _dimmed = false;
+  setLevel(level);
+}
+
+/*!
+    @brief  Sets the level at once, ending any fade. It is the level the
+            backlight returns to after an idle dim.
+    @param  level  Perceptual level, 0 to 255.
+*/
+template <class Device>
+void TFT_Backlight<Device>::setLevel(uint8_t level) {
+  _active = level;
+  if (!_dimmed) start(level, 0);
+}
+
+/*!
+    @brief  Fades to a level, linearly in perceptual steps. While dimmed the
+            level is kept for activity() instead.
+    @param  level  Perceptual level, 0 to 255.
+    @param  ms  Fade duration in milliseconds.
+*/
+template <class Device>
+void TFT_Backlight<Device>::fadeTo(uint8_t level, uint16_t ms) {
+  _active = level;
+  if (!_dimmed) start(level, ms);
+}
+
+/*!
+    @brief  Dims the backlight after a time without activity().
+    @param  timeoutMs  Idle time in milliseconds, 0 to never dim.
+    @param  level  Perceptual level while dimmed.
+    @param  fadeMs  Duration of the fade down.
+*/
+template <class Device>
+void TFT_Backlight<Device>::setIdleDim(uint32_t timeoutMs, uint8_t level,
+                                       uint16_t fadeMs) {
+  _idleMs = timeoutMs;
+  _idleLevel = level;
+  _idleFadeMs = fadeMs;
+  _lastActive = millis();
+}
+
+/*!
+    @brief  Records user activity, restarting the idle time. A dimmed
+            backlight fades back up in TFT_BACKLIGHT_WAKE_MS.
+*/
+template <class Device>
+void TFT_Backlight<Device>::activity(void) {
+  _lastActive = millis();
+  if (_dimmed) {
+    _dimmed = false;
+    start(_active, TFT_BACKLIGHT_WAKE_MS);
+  }
+}
+
+/*!
+    @brief  Steps the fade in progress and dims the backlight once idle for
+            too long. Call it from loop() as often as possible.
+    @return true while fading.
+*/
+template <class Device>
+bool TFT_Backlight<Device>::service(void) {
+  uint32_t now = millis();
+
+  if (_idleMs && !_dimmed && now - _lastActive >= _idleMs &&
+      _active > _idleLevel) {
+    _dimmed = true;
+    start(_idleLevel, _idleFadeMs);
+  }
+
+  if (_level == _target) return false;
+  if (now - _lastStep < TFT_BACKLIGHT_STEP_MS) return true;
+  _lastStep = now;
+
+  uint32_t t = now - _fadeStart;
+  if (t >= _fadeMs) {
+    write(_target);
+  } else if (_target > _from) {
+    write(_from + (uint32_t)(_target - _from) * t / _fadeMs);
+  } else {
+    write(_from - (uint32_t)(_from - _target) * t / _fadeMs);
+  }
+  return _level != _target;
+}
+
+/*!
+    @brief  Starts a fade from the level shown.
+    @param  level  Level to end at.
+    @param  ms  Duration, 0 to set the level at once.
+*/
+template <class Device>
+void TFT_Backlight<Device>::start(uint8_t level, uint16_t ms) {
+  _from = _level;
+  _target = level;
+  _fadeMs = ms;
+  _fadeStart = _lastStep = millis();
+  if (ms == 0) write(level);
+}
+
+/*!
+    @brief  Sends a level's duty cycle to the pin or the display.
+    @param  level  Perceptual level, 0 to 255.
+*/
+template <class Device>
+void TFT_Backlight<Device>::write(uint8_t level) {
+  _level = level;
+  if (_pin >= 0) {
+    analogWrite(_pin, duty(level));
+  } else {
+    _dev.setBrightness(duty(level));
+  }
+}
+
+#endif  // end _TFT_BACKLIGHT_H_
@@ -0,0 +1,434 @@
+/*!
+ * @file TFT_Color.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_COLOR_H_
+#define _TFT_COLOR_H_
+
+#include "Arduino.h"
+
+// COLOR CONVERSIONS
+// -----------------------------------------------------------------------------
+// Every function but the span kernels is a C++11 constexpr: with constant
+// arguments the result is computed by the compiler, e.g.
+// TFT_Color::hsv565(200, 255, 255) costs the same as writing its 565 value by
+// hand. With run time arguments they are plain inline integer math.
+
+/*!
+  @brief  Color conversions, blending and lookup table generators for the
+          display's '565' RGB pixels.
+*/
+namespace TFT_Color {
+
+/*!
+    @brief  Converts 8-bit channels to a '565' RGB pixel.
+    @param  r  Red, 0-255.
+    @param  g  Green, 0-255.
+    @param  b  Blue, 0-255.
+    @return The 16-bit pixel.
+*/
+constexpr uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((uint16_t)(r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+/*!
+    @brief  Converts 8-bit channels to a '666' RGB pixel, the 18-bit format
+            sent as three bytes with the 6 bits at the top of each.
+    @param  r  Red, 0-255.
+    @param  g  Green, 0-255.
+    @param  b  Blue, 0-255.
+    @return The pixel as 0x00RRGGBB, low 2 bits of each byte clear.
+*/
+constexpr uint32_t rgb666(uint8_t r, uint8_t g, uint8_t b) {
+  return ((uint32_t)(r & 0xFC) << 16) | ((uint16_t)(g & 0xFC) << 8) |
+         (b & 0xFC);
+}
+
+/*!
+    @brief  Returns the red channel of a '565' pixel scaled to 0-255.
+    @param  c  The pixel.
+    @return Red, the top bits repeated in the low ones so 31 gives 255.
+*/
+constexpr uint8_t red(uint16_t c) {
+  return ((c >> 8) & 0xF8) | (c >> 13);
+}
+
+/*!
+    @brief  Returns the green channel of a '565' pixel scaled to 0-255.
+    @param  c  The pixel.
+    @return Green, the top bits repeated in the low ones so 63 gives 255.
+*/
+constexpr uint8_t green(uint16_t c) {
+  return ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);
+}
+
+/*!
+    @brief  Returns the blue channel of a '565' pixel scaled to 0-255.
+    @param  c  The pixel.
+    @return Blue, the top bits repeated in the low ones so 31 gives 255.
+*/
+constexpr uint8_t blue(uint16_t c) {
+  return ((c << 3) & 0xF8) | ((c >> 2) & 0x07);
+}
+
+/*!
+    @brief  Converts a '565' pixel to '666'.
+    @param  c  The pixel.
+    @return The pixel as 0x00RRGGBB, see rgb666().
+*/
+constexpr uint32_t to666(uint16_t c) {
+  return rgb666(red(c), green(c), blue(c));
+}
+
+/*!
+    @brief  Returns a shade of grey.
+    @param  l  Lightness, 0 is black and 255 white.
+    @return The 16-bit pixel.
+*/
+constexpr uint16_t gray(uint8_t l) { return rgb565(l, l, l); }
+
+/*!
+    @brief  Mixes two 8-bit channels.
+    @param  a  Channel at t = 0.
+    @param  b  Channel at t = 255.
+    @param  t  Weight of b, 0-255.
+    @return The rounded mix.
+*/
+constexpr uint8_t mix(uint8_t a, uint8_t b, uint8_t t) {
+  return ((uint16_t)a * (255 - t) + (uint16_t)b * t + 127) / 255;
+}
+
+/*!
+    @brief  Blends two pixels channel by channel, in gamma encoded space as
+            most blends do. Cheap, but the middle of a gradient looks dark.
+    @param  from  Pixel at alpha = 0.
+    @param  to    Pixel at alpha = 255.
+    @param  alpha  Weight of to, 0-255.
+    @return The blended pixel.
+*/
+constexpr uint16_t blend(uint16_t from, uint16_t to, uint8_t alpha) {
+  return rgb565(mix(red(from), red(to), alpha),
+                mix(green(from), green(to), alpha),
+                mix(blue(from), blue(to), alpha));
+}
+
+/*!
+    @brief  Integer square root by bisection between lo and hi.
+    @param  n   The number.
+    @param  lo  A value whose square is at most n.
+    @param  hi  A value whose square is above n.
+    @return The largest value whose square is at most n.
+*/
+constexpr uint16_t isqrt(uint32_t n, uint32_t lo = 0, uint32_t hi = 65536) {
+  return hi - lo <= 1 ? lo
+         : ((lo + hi) / 2) * ((lo + hi) / 2) <= n
+             ? isqrt(n, (lo + hi) / 2, hi)
+             : isqrt(n, lo, (lo + hi) / 2);
+}
+
+/*!
+    @brief  Mixes two 8-bit channels in linear light, taking the display's
+            gamma as 2: the channels are squared, mixed, then square rooted.
+    @param  a  Channel at t = 0.
+    @param  b  Channel at t = 255.
+    @param  t  Weight of b, 0-255.
+    @return The mix, gamma encoded again.
+*/
+constexpr uint8_t mixLinear(uint8_t a, uint8_t b, uint8_t t) {
+  return isqrt(((uint32_t)a * a * (255 - t) + (uint32_t)b * b * t) / 255);
+}
+
+/*!
+    @brief  Interpolates two pixels in linear light, so gradients keep an
+            even brightness instead of dipping in the middle like blend().
+    @param  from  Pixel at t = 0.
+    @param  to    Pixel at t = 255.
+    @param  t     Position, 0-255.
+    @return The interpolated pixel.
+*/
+constexpr uint16_t lerpGamma(uint16_t from, uint16_t to, uint8_t t) {
+  return rgb565(mixLinear(red(from), red(to), t),
+                mixLinear(green(from), green(to), t),
+                mixLinear(blue(from), blue(to), t));
+}
+
+/*!
+    @brief  Returns a channel of hsv565() at a step of the hue wheel.
+    @param  k  Step of the channel: 0 and 5 at full value, 1 falling, 4
+               rising, 2 and 3 at the bottom.
+    @param  f  Position in the step, 0-255.
+    @param  s  Saturation, 0-255.
+    @param  v  Value, 0-255.
+    @return The channel, 0-255.
+*/
+constexpr uint8_t hsvLevel(uint8_t k, uint8_t f, uint8_t s, uint8_t v) {
+  return k == 0 || k == 5 ? v
+         : k == 1 ? (uint16_t)v * (255 - (uint16_t)s * f / 255) / 255
+         : k == 4 ? (uint16_t)v * (255 - (uint16_t)s * (255 - f) / 255) / 255
+                  : (uint16_t)v * (255 - s) / 255;
+}
+
+/*!
+    @brief  Converts a hue, saturation and value to a '565' pixel.
+    @param  h  Hue in degrees, 0-359: red at 0, green at 120, blue at 240.
+    @param  s  Saturation, 0-255.
+    @param  v  Value, 0-255.
+    @return The 16-bit pixel.
+*/
+constexpr uint16_t hsv565(uint16_t h, uint8_t s, uint8_t v) {
+  return rgb565(hsvLevel((h % 360 / 60 + 0) % 6, h % 60 * 255 / 60, s, v),
+                hsvLevel((h % 360 / 60 + 4) % 6, h % 60 * 255 / 60, s, v),
+                hsvLevel((h % 360 / 60 + 2) % 6, h % 60 * 255 / 60, s, v));
+}
+
+/*!
+    @brief  Spreads a '565' pixel over 32 bits for the blend kernels: green
+            moves to the top half so every channel has 5 free bits above
+            it, room for a product with a 5-bit alpha.
+    @param  c  The pixel.
+    @return The pixel as 00000GGG GGG00000 RRRRR000 000BBBBB.
+*/
+constexpr uint32_t spread(uint16_t c) {
+  return (c | ((uint32_t)c << 16)) & 0x07E0F81FUL;
+}
+
+/*!
+    @brief  Packs a spread() pixel back to '565'.
+    @param  s  The spread pixel, free bits clear.
+    @return The 16-bit pixel.
+*/
+constexpr uint16_t pack(uint32_t s) { return s | (s >> 16); }
+
+/*!
+    @brief  Scales an 8-bit alpha to the kernels' 5-bit one.
+    @param  alpha  Opacity, 0-255.
+    @return Opacity, 0-32.
+*/
+constexpr uint8_t alpha5(uint8_t alpha) {
+  return ((uint16_t)alpha * 33) >> 8;
+}
+
+/*!
+    @brief  Blends a pixel over another with the packed 32-bit kernel: the
+            three channels are weighted with two multiplications instead of
+            six.
+    @param  fg  Pixel drawn over.
+    @param  bg  Pixel under it.
+    @param  a  Opacity of fg, 0-32, see alpha5().
+    @return The blended pixel.
+*/
+constexpr uint16_t alphaBlend(uint16_t fg, uint16_t bg, uint8_t a) {
+  return pack(((spread(fg) * a + spread(bg) * (32 - a)) >> 5) & 0x07E0F81FUL);
+}
+
+/*!
+    @brief  Blends one color over a span of pixels in place. The color's
+            weighted term is computed once for the whole span.
+    @param  dst  The pixels, e.g. read back from the display.
+    @param  color  Pixel drawn over.
+    @param  a  Opacity of color, 0-32, see alpha5().
+    @param  n  Number of pixels.
+*/
+inline void blendSpan(uint16_t *dst, uint16_t color, uint8_t a, uint16_t n) {
+  uint32_t fg = spread(color) * a;
+  uint8_t ia = 32 - a;
+
+  while (n > 0) {
+    *dst = pack(((fg + spread(*dst) * ia) >> 5) & 0x07E0F81FUL);
+    dst++;
+    n--;
+  }
+}
+
+/*!
+    @brief  Returns the mask keeping each channel's own bits once a '565'
+            pixel is shifted right, see dim().
+    @param  shift  Right shifts, 0-5.
+    @return The mask, 0 from 6 shifts up.
+*/
+constexpr uint16_t dimMask(uint8_t shift) {
+  return shift > 5 ? 0
+                   : ((0xF800 >> shift) & 0xF800) |
+                         ((0x07E0 >> shift) & 0x07E0) |
+                         ((0x001F >> shift) & 0x001F);
+}
+
+/*!
+    @brief  Darkens a pixel by shifting its three channels right at once.
+    @param  c  The pixel.
+    @param  shift  Right shifts: 1 halves each channel, 6 and above give
+                   black.
+    @return The darkened pixel.
+*/
+constexpr uint16_t dim(uint16_t c, uint8_t shift) {
+  return shift > 5 ? 0 : (c >> shift) & dimMask(shift);
+}
+
+/*!
+    @brief  Darkens a span of pixels in place, see dim().
+    @param  px  The pixels, e.g. read back from the display.
+    @param  shift  Right shifts of each channel.
+    @param  n  Number of pixels.
+*/
+inline void dimSpan(uint16_t *px, uint8_t shift, uint16_t n) {
+  if (shift > 5) shift = 6;  // Keeps the shift within 16 bits.
+  uint16_t mask = dimMask(shift);
+
+  while (n > 0) {
+    *px = (*px >> shift) & mask;
+    px++;
+    n--;
+  }
+}
+
+}  // namespace TFT_Color
+
+// LOOKUP TABLES
+// -----------------------------------------------------------------------------
+// A generator is a type with a `size` and a constexpr `at(i)`. TFT_Lut expands
+// at(0) ... at(size - 1) into a PROGMEM array at compile time, through a pack
+// of indices (C++11 has no constexpr loops).
+
+/*!
+  @brief  A compile-time list of indices.
+*/
+template <uint16_t... I>
+struct TFT_Indices {};
+
+/*!
+  @brief  Joins two index lists, offsetting the second by the first's size.
+*/
+template <class A, class B>
+struct TFT_IndicesJoin;
+
+/*!
+  @brief  Joins two index lists, offsetting the second by the first's size.
+*/
+template <uint16_t... A, uint16_t... B>
+struct TFT_IndicesJoin<TFT_Indices<A...>, TFT_Indices<B...> > {
+  typedef TFT_Indices<A..., (sizeof...(A) + B)...> type;  ///< 0 ... A+B-1.
+};
+
+/*!
+  @brief  Makes the indices 0 ... N-1, halving N at each step so the
+          template depth is log2(N).
+*/
+template <uint16_t N>
+struct TFT_MakeIndices {
+  typedef typename TFT_IndicesJoin<
+      typename TFT_MakeIndices<N / 2>::type,
+      typename TFT_MakeIndices<N - N / 2>::type>::type type;  ///< 0 ... N-1.
+};
+
+/*!
+  @brief  No indices.
+*/
+template <>
+struct TFT_MakeIndices<0> {
+  typedef TFT_Indices<> type;  ///< Empty list.
+};
+
+/*!
+  @brief  The single index 0.
+*/
+template <>
+struct TFT_MakeIndices<1> {
+  typedef TFT_Indices<0> type;  ///< Just 0.
+};
+
+/*!
+  @brief  The PROGMEM array of a generator, expanded over an index list.
+*/
+template <class Gen, class Indices>
+struct TFT_LutData;
+
+/*!
+  @brief  The PROGMEM array of a generator, expanded over an index list.
+*/
+template <class Gen, uint16_t... I>
+struct TFT_LutData<Gen, TFT_Indices<I...> > {
+  static const uint16_t data[sizeof...(I)];  ///< Gen::at(i) for each i.
+};
+
+template <class Gen, uint16_t... I>
+const uint16_t TFT_LutData<Gen, TFT_Indices<I...> >::data[sizeof...(I)]
+    PROGMEM = {Gen::at(I)...};
+
+/*!
+  @brief  A table of colors generated at compile time and kept in PROGMEM.
+          Only the tables used are linked in, each once.
+
+  @code
+    typedef TFT_Lut<TFT_Gradient<ILI9341_NAVY, ILI9341_CYAN, 64> > Sky;
+    for (uint8_t i = 0; i < Sky::size; i++)
+      tft.drawShape(0, i * 5, 240, 5, 0, 0, 0, Sky::read(i));
+  @endcode
+*/
+template <class Gen>
+struct TFT_Lut
+    : TFT_LutData<Gen, typename TFT_MakeIndices<Gen::size>::type> {
+  static const uint16_t size = Gen::size;  ///< Number of colors.
+
+  /*!
+      @brief  Reads a color from the table.
+      @param  i  Index, below size.
+      @return The 16-bit pixel.
+  */
+  static uint16_t read(uint16_t i) {
+    return pgm_read_word(&TFT_Lut::data[i]);
+  }
+};
+
+/*!
+  @brief  Generator of an N color gradient, interpolated in linear light by
+          TFT_Color::lerpGamma().
+*/
+template <uint16_t From, uint16_t To, uint16_t N>
+struct TFT_Gradient {
+  static const uint16_t size = N;  ///< Number of colors.
+
+  /*!
+      @brief  Returns a color of the gradient.
+      @param  i  Index, from From at 0 to To at N - 1.
+      @return The 16-bit pixel.
+  */
+  static constexpr uint16_t at(uint16_t i) {
+    return TFT_Color::lerpGamma(From, To, N > 1 ? i * 255UL / (N - 1) : 0);
+  }
+};
+
+/*!
+  @brief  Generator of N hues evenly spaced around the color wheel.
+*/
+template <uint16_t N, uint8_t S = 255, uint8_t V = 255>
+struct TFT_HueWheel {
+  static const uint16_t size = N;  ///< Number of colors.
+
+  /*!
+      @brief  Returns a color of the wheel.
+      @param  i  Index, red at 0.
+      @return The 16-bit pixel.
+  */
+  static constexpr uint16_t at(uint16_t i) {
+    return TFT_Color::hsv565(i * 360UL / N, S, V);
+  }
+};
+
+#endif  // end _TFT_COLOR_H_
@@ -0,0 +1,91 @@
+/*!
+ * @file TFT_Config.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_CONFIG_H_
+#define _TFT_CONFIG_H_
+
+// BUILD CONFIGURATION
+// -----------------------------------------------------------------------------
+// Selects the subsystems compiled into the library. Each value can be edited
+// here or passed as a compiler flag, e.g. with arduino-cli:
+//   --build-property "compiler.cpp.extra_flags=-DTFT_COMPACT"
+// extras/size_report.py builds a sketch with each configuration and reports
+// the avr-size of the result.
+
+#if defined(TFT_COMPACT)
+// Smallest build: rectangles and lines drawn with integer math only.
+#ifndef TFT_ENABLE_TEXT
+#define TFT_ENABLE_TEXT 0
+#endif
+#ifndef TFT_ENABLE_CIRCLES
+#define TFT_ENABLE_CIRCLES 0
+#endif
+#ifndef TFT_ENABLE_IMAGES
+#define TFT_ENABLE_IMAGES 0
+#endif
+#ifndef TFT_ENABLE_READBACK
+#define TFT_ENABLE_READBACK 0
+#endif
+#ifndef TFT_ENABLE_FLOAT_MATH
+#define TFT_ENABLE_FLOAT_MATH 0
+#endif
+#endif  // TFT_COMPACT
+
+#ifndef TFT_ENABLE_TEXT
+#define TFT_ENABLE_TEXT 1  ///< Adafruit_GFX text, font and Processing API.
+#endif
+
+#ifndef TFT_ENABLE_CIRCLES
+#define TFT_ENABLE_CIRCLES 1  ///< Circles and rounded corners in drawShape().
+#endif
+
+#ifndef TFT_ENABLE_IMAGES
+#define TFT_ENABLE_IMAGES 1  ///< writeImage() and the SD card PImage loader.
+#endif
+
+#ifndef TFT_ENABLE_READBACK
+#define TFT_ENABLE_READBACK 1  ///< Reading the display registers back.
+#endif
+
+#ifndef TFT_ENABLE_FLOAT_MATH
+#define TFT_ENABLE_FLOAT_MATH 1  ///< sqrt()/round() in the circle algorithm.
+#endif
+
+#ifndef TFT_ENABLE_STATS
+#define TFT_ENABLE_STATS 0  ///< Count the bytes sent over SPI (benchmarks).
+#endif
+
+#ifndef TFT_ENABLE_TRACE
+#define TFT_ENABLE_TRACE 0  ///< Record the SPI byte stream with TFT_Trace.
+#endif
+
+#ifndef TFT_ENABLE_PROFILE
+#define TFT_ENABLE_PROFILE 0  ///< Timestamp draw calls with TFT_Profile.
+#endif
+
+// Pixels written between two yield()/wdt_reset() calls in long transfers. A
+// full screen fill takes a few hundred milliseconds on a 16 MHz AVR, longer
+// than the shorter watchdog timeouts. 0 writes every transfer in one go.
+#ifndef TFT_TRANSFER_CHUNK
+#define TFT_TRANSFER_CHUNK 0  ///< Pixels per chunk of writeData16(), 0 is off.
+#endif
+
+#endif  // end _TFT_CONFIG_H_
@@ -0,0 +1,69 @@
+/*!
+ * @file TFT_Fast.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_FAST_H_
+#define _TFT_FAST_H_
+
+#include "TFT_SPI.h"
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Fast is the statically dispatched counterpart of TFT_GFX. It
+          draws on a `Device` (e.g. AVR_ILI9341) with the same TFT_Draw
+          algorithms, but every span reaches the device through qualified,
+          non-virtual calls the compiler can inline.
+
+  @code
+    AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+    TFT_Fast<AVR_ILI9341> fast(tft);
+
+    fast.drawShape(10, 10, 100, 50, 8, 2, ILI9341_WHITE, ILI9341_BLUE);
+  @endcode
+*/
+template <class Device>
+class TFT_Fast : public TFT_Draw<TFT_Fast<Device> > {
+ public:
+  /*!
+      @brief  Binds the fast drawing interface to a device.
+      @param  dev  The device drawn on. Its rotation is followed.
+  */
+  explicit TFT_Fast(Device &dev) : _dev(dev) {}
+
+  uint16_t width(void) const { return _dev.width(); }
+  uint16_t height(void) const { return _dev.height(); }
+
+  void setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    _dev.Device::setAddressWindow(x1, y1, x2, y2);
+  }
+
+  void writeData16(uint16_t color, uint32_t num) {
+    _dev.TFT_SPI::writeData16(color, num);
+  }
+
+  void endWrite(void) { _dev.TFT_SPI::endWrite(); }
+
+ private:
+  Device &_dev;  ///< Device drawn on.
+};
+
+#endif  // end _TFT_FAST_H_
@@ -23,13 +23,15 @@
 #define _TFT_GFX_H_
 
 #include "Arduino.h"
+#include "TFT_Draw.h"
 
 /**
- * @brief Defines a circle's subdivision into Top and Bottom hemispheres.
+ * @brief TFT_GFX is the virtual canvas interface. Its drawing algorithms come
+ *        from TFT_Draw and reach the hardware through the virtual
+ *        `setAddressWindow()`, `writeData16()` and `endWrite()`. Use TFT_Fast
+ *        to get the same algorithms without the indirect calls.
  */
-enum segment { Top, Bottom };
-
-class TFT_GFX {
+class TFT_GFX : public TFT_Draw<TFT_GFX> {
  public:
   TFT_GFX(uint16_t w, uint16_t h);  // Constructor
 
@@ -38,23 +40,32 @@ class TFT_GFX {
   virtual void writeData16(uint16_t color, uint32_t num) = 0;
   virtual void setAddressWindow(uint16_t x, uint16_t y, uint16_t w,
                                 uint16_t h) = 0;
+  virtual void endWrite(void) = 0;
+
+  /**
+   * @brief Returns the display width at the current rotation.
+   * @return Number of pixels along the x axis.
+   */
+  uint16_t width(void) const { return _width; }
 
-  void fillScreen(uint16_t color);
+  /**
+   * @brief Returns the display height at the current rotation.
+   * @return Number of pixels along the y axis.
+   */
+  uint16_t height(void) const { return _height; }
 
-  void drawShape(uint16_t xAxis, uint16_t yAxis, uint16_t length,
-                 uint16_t breadth, uint16_t radius, uint8_t strokePixels,
-                 uint16_t strokeColor, uint16_t fillColor);
+  /**
+   * @brief Returns the current display rotation.
+   * @return Rotation index, from 0-3 inclusive.
+   */
+  uint8_t getRotation(void) const { return rotation; }
 
  protected:
   uint16_t _width, _height;
   uint8_t rotation;
-
- private:
-  uint16_t circleAlgo(uint16_t y, uint16_t radius);
-  void plotOctets(segment hemisphere, uint16_t xCenter, uint16_t yCenter,
-                  uint16_t xOutline, uint16_t yOutline, uint16_t length,
-                  uint16_t color);
-  void setScreenData(uint16_t xPos, uint16_t yPos, uint16_t _xFillPx,
-                     uint8_t _depth, uint16_t _fillcolor);
 };
+
+// Compiled once in TFT_GFX.cpp rather than in every sketch file.
+extern template class TFT_Draw<TFT_GFX>;
+
 #endif  // end _TFT_GFX_H_
@@ -0,0 +1,230 @@
+/*!
+ * @file TFT_Health.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_HEALTH_H_
+#define _TFT_HEALTH_H_
+
+#include "TFT_SPI.h"
+
+#if TFT_ENABLE_READBACK
+
+#ifndef TFT_HEALTH_BUDGET
+#define TFT_HEALTH_BUDGET 20  ///< SPI bytes per second, a round a second.
+#endif
+
+#define TFT_HEALTH_REGS 5            ///< Registers checked, one per read.
+#define TFT_HEALTH_READ_BYTES 4      ///< SPI bytes of one readcommand().
+#define TFT_HEALTH_REINIT_BYTES 128  ///< SPI bytes of one reinit(), about.
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Health watches the display for resets and scrambled registers,
+          e.g. after an electrostatic discharge, which otherwise only show as
+          a white or garbled screen. Each service() reads one of Read Display
+          Status, Power Mode, MADCTL, Pixel Format and Self-Diagnostic, in
+          turn, and compares it with the value read at begin(). A register
+          that differs twice in a row resets the display with reinit() and
+          calls the repaint callback to draw the screen again.
+
+          The reads share the bus with drawing, so they are paced by a
+          budget of SPI bytes per second: a token bucket filled at that rate
+          and holding one round of reads. A recovery is paid from the same
+          bucket, so a display that keeps failing is reset at most every
+          TFT_HEALTH_REINIT_BYTES / budget seconds.
+
+  @code
+    TFT_Health<AVR_ILI9341> health(tft, drawScreen);
+
+    tft.begin();
+    drawScreen();
+    health.begin();  // Reads the registers as configured.
+
+    void loop() {
+      health.service();  // Between draw calls.
+    }
+  @endcode
+*/
+template <class Device>
+class TFT_Health {
+ public:
+  /*!
+      @brief  Draws the whole screen again after a recovery.
+  */
+  typedef void (*Repaint)(void);
+
+  /*!
+      @brief  Binds the monitor to a device.
+      @param  dev  The device watched.
+      @param  repaint  Called after each recovery, may be NULL.
+      @param  budget  SPI bytes per second spent on the checks.
+  */
+  TFT_Health(Device &dev, Repaint repaint = NULL,
+             uint16_t budget = TFT_HEALTH_BUDGET)
+      : _dev(dev), _repaint(repaint), _budget(budget), _credit(0),
+        _lastFill(0), _next(0), _rotation(0), _started(false),
+        _recoveries(0) {
+    memset(_expected, 0, sizeof(_expected));
+  }
+
+  void begin(void);
+  void expect(void);
+  bool service(void);
+
+  /*!
+      @brief  Changes the SPI budget of the checks.
+      @param  budget  SPI bytes per second, 0 stops the checks.
+  */
+  void setBudget(uint16_t budget) { _budget = budget; }
+
+  /*!
+      @brief  Returns the number of recoveries since begin().
+      @return Times the display was reset and repainted.
+  */
+  uint16_t recoveries(void) const { return _recoveries; }
+
+ private:
+  static uint8_t reg(uint8_t i);
+  void refill(void);
+
+  Device &_dev;          ///< Device watched.
+  Repaint _repaint;      ///< Repaint callback, may be NULL.
+  uint16_t _budget;      ///< SPI bytes per second.
+  int32_t _credit;       ///< Bucket level in 1/1000 bytes, negative in debt.
+  uint32_t _lastFill;    ///< millis() at the last refill.
+  uint8_t _next;         ///< Index of the register read next.
+  uint8_t _rotation;     ///< Device rotation when the registers were read.
+  bool _started;         ///< begin() was called, _expected is valid.
+  uint16_t _recoveries;  ///< Recoveries since begin().
+
+  uint8_t _expected[TFT_HEALTH_REGS];  ///< Register values when healthy.
+};
+
+/*!
+    @brief  Reads the expected register values and starts with a full
+            bucket. Call it once the display is configured.
+*/
+template <class Device>
+void TFT_Health<Device>::begin(void) {
+  expect();
+  _credit = (int32_t)TFT_HEALTH_REGS * TFT_HEALTH_READ_BYTES * 1000;
+  _lastFill = millis();
+  _next = 0;
+  _started = true;
+  _recoveries = 0;
+}
+
+/*!
+    @brief  Reads the expected register values again, e.g. after the
+            display was put to sleep on purpose. Rotation changes are
+            picked up by service() itself.
+*/
+template <class Device>
+void TFT_Health<Device>::expect(void) {
+  for (uint8_t i = 0; i < TFT_HEALTH_REGS; i++) {
+    _expected[i] = _dev.readcommand(reg(i));
+  }
+  _rotation = _dev.getRotation();
+}
+
+/*!
+    @brief  Reads the next register if the budget allows it, and recovers
+            the display if it doesn't hold its expected value. Call it from
+            loop(), between draw calls.
+    @return true if the display was reset and repainted. Always false
+            before begin().
+*/
+template <class Device>
+bool TFT_Health<Device>::service(void) {
+  if (!_started || _budget == 0) return false;
+
+  refill();
+  if (_credit < (int32_t)TFT_HEALTH_READ_BYTES * 1000) return false;
+  _credit -= (int32_t)TFT_HEALTH_READ_BYTES * 1000;
+
+  // setRotation() rewrites MADCTL, which Read Display Status reports too.
+  if (_dev.getRotation() != _rotation) {
+    expect();
+    return false;
+  }
+
+  uint8_t i = _next;
+  _next = (_next + 1) % TFT_HEALTH_REGS;
+  if (_dev.readcommand(reg(i)) == _expected[i]) return false;
+
+  // A read corrupted on the way is not worth a reset: read again.
+  if (_dev.readcommand(reg(i)) == _expected[i]) return false;
+
+  _credit -= (int32_t)TFT_HEALTH_REINIT_BYTES * 1000;
+  _dev.reinit();
+  _recoveries++;
+  if (_repaint) _repaint();
+  return true;
+}
+
+/*!
+    @brief  Returns a register checked.
+    @param  i  Register index, 0 to TFT_HEALTH_REGS - 1.
+    @return Read Display Status, Power Mode, MADCTL, Pixel Format or
+            Self-Diagnostic Result.
+*/
+template <class Device>
+uint8_t TFT_Health<Device>::reg(uint8_t i) {
+  switch (i) {
+    case 0:
+      return 0x09;  // RDDST
+    case 1:
+      return 0x0A;  // RDMODE
+    case 2:
+      return 0x0B;  // RDMADCTL
+    case 3:
+      return 0x0C;  // RDPIXFMT
+    default:
+      return 0x0F;  // RDSELFDIAG
+  }
+}
+
+/*!
+    @brief  Adds the budget earned since the last refill to the bucket, up
+            to one round of reads.
+*/
+template <class Device>
+void TFT_Health<Device>::refill(void) {
+  const int32_t full = (int32_t)TFT_HEALTH_REGS * TFT_HEALTH_READ_BYTES * 1000;
+
+  uint32_t now = millis();
+  uint32_t ms = now - _lastFill;
+  _lastFill = now;
+
+  // Past the time the bucket takes to fill from empty, it is full.
+  int32_t debt = _credit < 0 ? -_credit : 0;
+  if (ms > (uint32_t)(full + debt) / _budget) {
+    _credit = full;
+  } else {
+    _credit += (int32_t)(ms * _budget);
+    if (_credit > full) _credit = full;
+  }
+}
+
+#endif  // end TFT_ENABLE_READBACK
+
+#endif  // end _TFT_HEALTH_H_
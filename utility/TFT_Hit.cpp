@@ -0,0 +1,195 @@
+/*!
+ * @file TFT_Hit.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "TFT_Hit.h"
+
+/*!
+    @brief   TFT_Hit constructor, with no widgets.
+    @param   gfx  Canvas whose rotation the coordinates follow.
+*/
+TFT_Hit::TFT_Hit(TFT_GFX &gfx) : _gfx(gfx) {
+  setLayout(NULL);
+  clear();
+}
+
+/*!
+    @brief  Sets the static layout, e.g. when the UI changes screen.
+    @param  layout  Layout in PROGMEM generated by extras/hit_layout.py, or
+                    NULL for none.
+*/
+void TFT_Hit::setLayout(const TFT_HitLayout *layout) {
+  if (layout == NULL) {
+    memset(&_layout, 0, sizeof(_layout));
+    return;
+  }
+  memcpy_P(&_layout, layout, sizeof(_layout));
+}
+
+/*!
+    @brief  Adds a widget at run time, above the static layout.
+    @param  x  Leftmost column at the current rotation.
+    @param  y  Topmost row at the current rotation.
+    @param  w  Width in pixels.
+    @param  h  Height in pixels.
+    @param  id  Widget ID returned by hit().
+    @return false if the rectangle is empty or off the display, or if
+            TFT_HIT_DYNAMIC widgets were already added.
+*/
+bool TFT_Hit::add(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                  uint16_t id) {
+  if (w == 0 || h == 0 || x + w > _gfx.width() || y + h > _gfx.height())
+    return false;
+
+  uint8_t slot = 0;
+  while (slot < TFT_HIT_DYNAMIC && (_used & (1U << slot))) slot++;
+  if (slot == TFT_HIT_DYNAMIC) return false;
+
+  // Opposite corners at rotation 0.
+  uint16_t x1 = x, y1 = y, x2 = x + w - 1, y2 = y + h - 1;
+  toNative(&x1, &y1);
+  toNative(&x2, &y2);
+  if (x1 > x2) {
+    uint16_t t = x1;
+    x1 = x2;
+    x2 = t;
+  }
+  if (y1 > y2) {
+    uint16_t t = y1;
+    y1 = y2;
+    y2 = t;
+  }
+
+  TFT_HitRect &r = _rects[slot];
+  r.x = x1;
+  r.y = y1;
+  r.w = x2 - x1 + 1;
+  r.h = y2 - y1 + 1;
+  r.id = id;
+  _used |= 1U << slot;
+
+  for (uint8_t gy = row(y1); gy <= row(y2); gy++) {
+    for (uint8_t gx = column(x1); gx <= column(x2); gx++) {
+      _cells[gy * TFT_HIT_COLS + gx] |= 1U << slot;
+    }
+  }
+  return true;
+}
+
+/*!
+    @brief  Removes the widgets added at run time with the given ID.
+    @param  id  Widget ID passed to add().
+*/
+void TFT_Hit::remove(uint16_t id) {
+  uint16_t removed = 0;
+  for (uint8_t slot = 0; slot < TFT_HIT_DYNAMIC; slot++) {
+    if ((_used & (1U << slot)) && _rects[slot].id == id) removed |= 1U << slot;
+  }
+
+  if (removed == 0) return;
+  _used &= ~removed;
+  for (uint8_t i = 0; i < TFT_HIT_CELLS; i++) _cells[i] &= ~removed;
+}
+
+/*!
+    @brief  Removes all the widgets added at run time. The static layout is
+            kept.
+*/
+void TFT_Hit::clear(void) {
+  _used = 0;
+  memset(_cells, 0, sizeof(_cells));
+}
+
+/*!
+    @brief  Finds the widget at a point. Only the widgets over the point's
+            grid cell are tested.
+    @param  x  Column at the current rotation, e.g. from TFT_Touch::read().
+    @param  y  Row at the current rotation.
+    @return The ID of the widget hit, run time widgets first, then the
+            static ones in layout order. TFT_HIT_NONE if there is none.
+*/
+uint16_t TFT_Hit::hit(uint16_t x, uint16_t y) {
+  if (!toNative(&x, &y)) return TFT_HIT_NONE;
+  uint8_t cell = row(y) * TFT_HIT_COLS + column(x);
+
+  uint16_t slots = _cells[cell];
+  for (uint8_t slot = 0; slots != 0; slot++, slots >>= 1) {
+    if ((slots & 1) && inside(_rects[slot], x, y)) return _rects[slot].id;
+  }
+
+  if (_layout.rects == NULL) return TFT_HIT_NONE;
+
+  uint16_t first = pgm_read_word(&_layout.cellStart[cell]);
+  uint16_t last = pgm_read_word(&_layout.cellStart[cell + 1]);
+  for (uint16_t i = first; i < last; i++) {
+    uint16_t index = pgm_read_word(&_layout.cellRects[i]);
+    TFT_HitRect r;
+    memcpy_P(&r, &_layout.rects[index], sizeof(r));
+    if (inside(r, x, y)) return r.id;
+  }
+  return TFT_HIT_NONE;
+}
+
+/*!
+    @brief  Converts a point at the canvas's current rotation to rotation 0,
+            following the MADCTL of AVR_ILI9341::setRotation(), on a canvas
+            of the same size at rotation 0.
+    @param  x  Column, converted in place.
+    @param  y  Row, converted in place.
+    @return false if the point is off the display.
+*/
+bool TFT_Hit::toNative(uint16_t *x, uint16_t *y) {
+  if (*x >= _gfx.width() || *y >= _gfx.height()) return false;
+
+  uint8_t rotation = _gfx.getRotation();
+  uint16_t w = rotation & 1 ? _gfx.height() : _gfx.width();  // At rotation 0.
+  uint16_t h = rotation & 1 ? _gfx.width() : _gfx.height();
+
+  uint16_t x0 = *x, y0 = *y;
+  switch (rotation) {
+    case 1:
+      x0 = (w - 1) - *y;
+      y0 = *x;
+      break;
+    case 2:
+      x0 = (w - 1) - *x;
+      y0 = (h - 1) - *y;
+      break;
+    case 3:
+      x0 = *y;
+      y0 = (h - 1) - *x;
+      break;
+  }
+
+  *x = x0;
+  *y = y0;
+  return true;
+}
+
+/*!
+    @brief  Tells whether a point at rotation 0 is within a rectangle.
+    @param  r  The rectangle.
+    @param  x  Column at rotation 0.
+    @param  y  Row at rotation 0.
+    @return true if the point is within the rectangle.
+*/
+bool TFT_Hit::inside(const TFT_HitRect &r, uint16_t x, uint16_t y) {
+  return x >= r.x && x - r.x < r.w && y >= r.y && y - r.y < r.h;
+}
@@ -0,0 +1,116 @@
+/*!
+ * @file TFT_Hit.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_HIT_H_
+#define _TFT_HIT_H_
+
+#include "TFT_GFX.h"
+
+#define TFT_HIT_CELL 40  ///< Grid cell side, extras/hit_layout.py's --cell.
+#define TFT_HIT_COLS (240 / TFT_HIT_CELL)  ///< Grid columns at rotation 0.
+#define TFT_HIT_ROWS (320 / TFT_HIT_CELL)  ///< Grid rows at rotation 0.
+#define TFT_HIT_CELLS (TFT_HIT_COLS * TFT_HIT_ROWS)  ///< Grid cells.
+
+#define TFT_HIT_NONE 0xFFFF  ///< Widget ID returned when nothing is hit.
+
+#ifndef TFT_HIT_DYNAMIC
+#define TFT_HIT_DYNAMIC 16  ///< Widgets added at run time, 16 at most.
+#endif
+
+#if TFT_HIT_DYNAMIC > 16
+#error "TFT_HIT_DYNAMIC must not exceed 16, one bit per widget per cell"
+#endif
+
+/*!
+  @brief  A widget rectangle at rotation 0.
+*/
+struct TFT_HitRect {
+  uint16_t x;   ///< Leftmost column.
+  uint16_t y;   ///< Topmost row.
+  uint16_t w;   ///< Width in pixels.
+  uint16_t h;   ///< Height in pixels.
+  uint16_t id;  ///< Widget ID returned by TFT_Hit::hit().
+};
+
+/*!
+  @brief  A static layout generated by extras/hit_layout.py, all in PROGMEM:
+          the rectangles and, for every grid cell, the rectangles over it.
+*/
+struct TFT_HitLayout {
+  const TFT_HitRect *rects;   ///< Widget rectangles at rotation 0.
+  const uint16_t *cellStart;  ///< First entry of each cell, TFT_HIT_CELLS+1.
+  const uint16_t *cellRects;  ///< Rectangle indices, topmost first per cell.
+};
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Hit finds the widget under a touched point. The screen is split
+          into a grid of TFT_HIT_CELL pixels square cells, each listing the
+          widgets over it, so a hit test only looks at the few widgets of
+          the touched cell. Static layouts stay in PROGMEM, widgets added at
+          run time are indexed in RAM and are above the static ones.
+          Points and rectangles are in the coordinates of the canvas's
+          current rotation. The grid covers 240x320 pixels at rotation 0;
+          on a larger canvas, e.g. a TFT_Wall, points past it fall in its
+          last row or column of cells.
+*/
+class TFT_Hit {
+ public:
+  explicit TFT_Hit(TFT_GFX &gfx);
+
+  void setLayout(const TFT_HitLayout *layout);
+  bool add(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t id);
+  void remove(uint16_t id);
+  void clear(void);
+
+  uint16_t hit(uint16_t x, uint16_t y);
+
+ private:
+  bool toNative(uint16_t *x, uint16_t *y);
+  static bool inside(const TFT_HitRect &r, uint16_t x, uint16_t y);
+
+  /*!
+      @brief  Returns the grid column of a column at rotation 0.
+  */
+  static uint8_t column(uint16_t x) {
+    x /= TFT_HIT_CELL;
+    return x < TFT_HIT_COLS ? x : TFT_HIT_COLS - 1;
+  }
+
+  /*!
+      @brief  Returns the grid row of a row at rotation 0.
+  */
+  static uint8_t row(uint16_t y) {
+    y /= TFT_HIT_CELL;
+    return y < TFT_HIT_ROWS ? y : TFT_HIT_ROWS - 1;
+  }
+
+  TFT_GFX &_gfx;          ///< Canvas giving the current rotation.
+  TFT_HitLayout _layout;  ///< Static layout, PROGMEM pointers or NULL.
+
+  TFT_HitRect _rects[TFT_HIT_DYNAMIC];  ///< Run time widgets at rotation 0.
+  uint16_t _used;                       ///< Bit per _rects slot in use.
+  uint16_t _cells[TFT_HIT_CELLS];       ///< Bit per _rects slot over a cell.
+};
+
+#endif  // end _TFT_HIT_H_
@@ -0,0 +1,93 @@
+/*!
+ * @file TFT_Profile.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "TFT_Profile.h"
+
+#if TFT_ENABLE_PROFILE
+
+TFT_Profile::Event TFT_Profile::_events[TFT_PROFILE_EVENTS];
+uint8_t TFT_Profile::_next = 0;
+uint8_t TFT_Profile::_count = 0;
+uint32_t TFT_Profile::_dropped = 0;
+
+/*!
+    @brief  Records the entry of a span.
+    @param  id  The span ID, one of the TFT_PROF_* values or a sketch's own
+                from TFT_PROF_USER.
+*/
+void TFT_Profile::enter(uint8_t id) { record(id & ~TFT_PROF_EXIT); }
+
+/*!
+    @brief  Records the exit of a span.
+    @param  id  The span ID given to enter().
+*/
+void TFT_Profile::exit(uint8_t id) { record(id | TFT_PROF_EXIT); }
+
+/*!
+    @brief  Empties the ring buffer.
+*/
+void TFT_Profile::clear(void) {
+  _next = 0;
+  _count = 0;
+  _dropped = 0;
+}
+
+/*!
+    @brief  Streams the buffered events, oldest first, as CSV lines of
+            "time_us,id,phase" where phase is B (entry) or E (exit), then
+            empties the buffer. A "dropped,<n>" line first reports the events
+            overwritten since the last dump.
+    @param  out  Where the events are printed, e.g. Serial.
+*/
+void TFT_Profile::dump(Print &out) {
+  out.print(F("dropped,"));
+  out.println(_dropped);
+
+  uint8_t index = (_next + TFT_PROFILE_EVENTS - _count) % TFT_PROFILE_EVENTS;
+  for (uint8_t i = 0; i < _count; i++) {
+    const Event &event = _events[index];
+    out.print(event.time);
+    out.print(',');
+    out.print(event.id & ~TFT_PROF_EXIT);
+    out.println(event.id & TFT_PROF_EXIT ? F(",E") : F(",B"));
+    index = (index + 1) % TFT_PROFILE_EVENTS;
+  }
+
+  clear();
+}
+
+/*!
+    @brief  Timestamps an event into the ring buffer.
+    @param  id  The event ID, TFT_PROF_EXIT set on exit.
+*/
+void TFT_Profile::record(uint8_t id) {
+  _events[_next].time = micros();
+  _events[_next].id = id;
+  _next = (_next + 1) % TFT_PROFILE_EVENTS;
+
+  if (_count < TFT_PROFILE_EVENTS) {
+    _count++;
+  } else {
+    _dropped++;
+  }
+}
+
+#endif  // TFT_ENABLE_PROFILE
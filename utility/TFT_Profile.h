@@ -0,0 +1,98 @@
+/*!
+ * @file TFT_Profile.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_PROFILE_H_
+#define _TFT_PROFILE_H_
+
+#include "Arduino.h"
+#include "TFT_Config.h"
+
+#ifndef TFT_PROFILE_EVENTS
+#define TFT_PROFILE_EVENTS 64  ///< Events kept in the ring buffer (<= 255).
+#endif
+
+// Library event IDs. Sketches mark their own spans, e.g. one per widget, with
+// IDs from TFT_PROF_USER up to 0x7F.
+#define TFT_PROF_FILL_SCREEN 0x01     ///< TFT_Draw::fillScreen()
+#define TFT_PROF_DRAW_SHAPE 0x02      ///< TFT_Draw::drawShape()
+#define TFT_PROF_ADDRESS_WINDOW 0x03  ///< AVR_ILI9341::setAddressWindow()
+#define TFT_PROF_DRAW_IMAGE 0x04      ///< AVR_ILI9341::drawImage()
+#define TFT_PROF_READ_PIXELS 0x05     ///< AVR_ILI9341::readPixels()
+#define TFT_PROF_SCROLL 0x06          ///< AVR_ILI9341::scrollTo()
+#define TFT_PROF_USER 0x40            ///< First ID free for sketches.
+
+#define TFT_PROF_EXIT 0x80  ///< Set in the ID of an exit event.
+
+#if TFT_ENABLE_PROFILE
+
+/*!
+  @brief  TFT_Profile timestamps the entry and exit of draw calls into a ring
+          buffer, overwriting the oldest events once full. dump() streams the
+          buffer out for extras/profile_to_chrome.py.
+*/
+class TFT_Profile {
+ public:
+  static void enter(uint8_t id);
+  static void exit(uint8_t id);
+  static void clear(void);
+  static void dump(Print &out);
+
+ private:
+  static void record(uint8_t id);
+
+  /*!
+    @brief  A timestamped event.
+  */
+  struct Event {
+    uint32_t time;  ///< micros() when the event happened.
+    uint8_t id;     ///< Event ID, TFT_PROF_EXIT set on exit.
+  };
+
+  static Event _events[TFT_PROFILE_EVENTS];  ///< Ring buffer.
+  static uint8_t _next;                      ///< Index of the next event.
+  static uint8_t _count;                     ///< Events in the buffer.
+  static uint32_t _dropped;                  ///< Events overwritten.
+};
+
+/*!
+  @brief  Records the entry of a span on construction and its exit when it
+          goes out of scope.
+*/
+class TFT_ProfileScope {
+ public:
+  explicit TFT_ProfileScope(uint8_t id) : _id(id) { TFT_Profile::enter(id); }
+  ~TFT_ProfileScope() { TFT_Profile::exit(_id); }
+
+ private:
+  uint8_t _id;  ///< ID of the span.
+};
+
+#define TFT_PROFILE_CAT(a, b) a##b                ///< Token pasting helper.
+#define TFT_PROFILE_NAME(a, b) TFT_PROFILE_CAT(a, b)  ///< Unique name helper.
+/// Profiles the rest of the enclosing scope as the span `id`.
+#define TFT_PROFILE(id) \
+  TFT_ProfileScope TFT_PROFILE_NAME(_tftProfile, __LINE__)(id)
+
+#else
+#define TFT_PROFILE(id)  ///< Profiling is disabled.
+#endif  // TFT_ENABLE_PROFILE
+
+#endif  // end _TFT_PROFILE_H_
@@ -23,6 +23,13 @@
 
 #include <pins_arduino.h>
 
+#if defined(__AVR__)
+#include <avr/wdt.h>
+
+// Stands in for the chip select's PORT register when there is no CS pin.
+static volatile uint8_t noCsPort;
+#endif
+
 /*!
     @brief   TFT_SPI constructor for hardware SPI using a specific
              SPI peripheral.
@@ -50,6 +57,33 @@ TFT_SPI::TFT_SPI(int8_t cs, int8_t dc, int8_t rst)
   HEIGHT = TFT_HEIGHT;  // Constant throughout the program lifetime
 
   hwspi._spi = &SPI;  // Pointer to SPIClass type.
+
+  _inTransaction = false;
+  _pixelsLeft = TFT_UNBOUNDED;
+  _windowErrors = 0;
+  _writeFreq = DEFAULT_SPI_FREQ;
+  _readFreq = TFT_READ_FREQ;
+  _spiMode = SPI_MODE0;
+
+#if TFT_ENABLE_STATS
+  _spiBytes = 0;
+#endif
+
+#if TFT_ENABLE_TRACE
+  _trace = NULL;
+#endif
+
+#if defined(__AVR__)
+  _dcPort = portOutputRegister(digitalPinToPort(dc));
+  _dcPinMask = digitalPinToBitMask(dc);
+  if (cs >= 0) {
+    _csPort = portOutputRegister(digitalPinToPort(cs));
+    _csPinMask = digitalPinToBitMask(cs);
+  } else {
+    _csPort = &noCsPort;  // Chip select tied low, CS_LOW() does nothing.
+    _csPinMask = 0;
+  }
+#endif
 }
 
 // CLASS MEMBER FUNCTIONS --------------------------------------------------
@@ -75,22 +109,23 @@ void TFT_SPI::initSPI(uint32_t freq, uint8_t spiMode) {
   if (!freq) freq = DEFAULT_SPI_FREQ;  // If no freq specified, use default
 
   // Init basic control pins common to all connection types
-  pinMode(_cs, OUTPUT);
+  if (_cs >= 0) pinMode(_cs, OUTPUT);
   pinMode(_dc, OUTPUT);
-  pinMode(_rst, OUTPUT);
+  if (_rst >= 0) pinMode(_rst, OUTPUT);
 
   // This are the same default pins defined in pins_arduino.h file
   pinMode(MOSI, OUTPUT);
   pinMode(MISO, INPUT);
   pinMode(SCK, OUTPUT);
 
-  pinMode(_dc, HIGH);  // Data mode set
-  pinMode(_cs, HIGH);  // Chipset disabled
+  DC_HIGH();  // Data mode set
+  CS_HIGH();  // Chipset disabled
 
   hwspi._spi->begin();
+  _spiMode = spiMode;
 #if defined(SPI_HAS_TRANSACTION)
-  hwspi.settings = SPISettings(
-      freq, MSBFIRST, spiMode);  // 8000000 gives max speed on AVR 16MHz
+  setWriteClock(freq);  // 8000000 gives max speed on AVR 16MHz
+  setReadClock(freq < TFT_READ_FREQ ? freq : TFT_READ_FREQ);
 #else
   hwspi._spi->setClockDivider(freq);  // 4 MHz (half speed)
   hwspi._spi->setBitOrder(MSBFIRST);
@@ -108,6 +143,31 @@ void TFT_SPI::initSPI(uint32_t freq, uint8_t spiMode) {
   }
 }
 
+/*!
+    @brief  Sets the clock of the transactions writing to the display, used
+            from the next SPI_START().
+    @param  freq  SPI clock in Hz, rounded down by the SPI hardware.
+*/
+void TFT_SPI::setWriteClock(uint32_t freq) {
+  _writeFreq = freq;
+#if defined(SPI_HAS_TRANSACTION)
+  hwspi.settings = SPISettings(freq, MSBFIRST, _spiMode);
+#endif
+}
+
+/*!
+    @brief  Sets the clock of the transactions reading the display back,
+            used from the next SPI_START_READ(). The ILI9341 reads with a
+            150 ns cycle at best, see TFT_READ_FREQ.
+    @param  freq  SPI clock in Hz, rounded down by the SPI hardware.
+*/
+void TFT_SPI::setReadClock(uint32_t freq) {
+  _readFreq = freq;
+#if defined(SPI_HAS_TRANSACTION)
+  hwspi.readSettings = SPISettings(freq, MSBFIRST, _spiMode);
+#endif
+}
+
 /*!
     @brief Initiates the SPI transaction if supported, to gain exclusive access
           to the SPI bus. Lastly it activates the chip select pin in that order
@@ -117,29 +177,146 @@ void TFT_SPI::SPI_START(void) {
   hwspi._spi->beginTransaction(hwspi.settings);
 #endif
 
-  digitalWrite(_cs, LOW);
+  _inTransaction = true;
+  _pixelsLeft = TFT_UNBOUNDED;  // No window is open yet.
+  CS_LOW();
+  TFT_TRACE(select(true));
+}
+
+/*!
+    @brief Same as SPI_START() but at the read clock, see setReadClock(),
+          for the transactions reading the display back: its read cycle is
+          slower than its write cycle.
+*/
+void TFT_SPI::SPI_START_READ(void) {
+#if defined(SPI_HAS_TRANSACTION)
+  hwspi._spi->beginTransaction(hwspi.readSettings);
+#endif
+
+  _inTransaction = true;
+  _pixelsLeft = TFT_UNBOUNDED;
+  CS_LOW();
+  TFT_TRACE(select(true));
 }
 
 /*!
     @brief Disables the chip select pin before releasing the access to the
-          SPI bus for others to use.
+          SPI bus for others to use. The trace is written out last, once the
+          bus is free: its output may be an SD card on the same bus.
 */
 void TFT_SPI::SPI_END(void) {
-  digitalWrite(_cs, HIGH);
+  CS_HIGH();
 
 #if defined(SPI_HAS_TRANSACTION)
   hwspi._spi->endTransaction();
+#endif
+  _inTransaction = false;
+  TFT_TRACE(select(false));
+}
+
+/*!
+    @brief  Ends the transaction started by setAddressWindow() once the
+            window's pixels are written, releasing the bus for the other
+            devices on it (e.g. a touch controller).
+*/
+void TFT_SPI::endWrite(void) { SPI_END(); }
+
+#if TFT_ENABLE_IMAGES
+#if TFT_SPDR_BLIT
+/*!
+    @brief  Reads a pixel byte from RAM or PROGMEM.
+    @param  p  The byte.
+    @return The byte.
+*/
+template <bool progmem>
+static inline uint8_t pixelByte(const uint8_t *p) {
+  return progmem ? pgm_read_byte(p) : *p;
+}
+
+/*!
+    @brief  Streams pixels to SPDR, bypassing SPI.transfer(). Each byte is
+            loaded while the previous one shifts out and written the moment
+            SPIF rises, two bytes per turn: SPI.transfer() instead waits for
+            the byte, returns what came in and only then loads the next one.
+    @param  p  The pixels, 2 * num bytes.
+    @param  num  Number of pixels, at least 1.
+    @note   `swapped` pixels are uint16_t in the AVR's little-endian order,
+            their bytes are simply loaded the other way round.
+*/
+template <bool progmem, bool swapped>
+static void streamPixels(const uint8_t *p, uint32_t num) {
+  const uint8_t s = swapped;
+
+  SPDR = pixelByte<progmem>(p + s);
+  while (--num > 0) {
+    uint8_t lo = pixelByte<progmem>(p + 1 - s);
+    uint8_t hi = pixelByte<progmem>(p + 2 + s);
+    p += 2;
+    while (!(SPSR & _BV(SPIF))) {
+    }
+    SPDR = lo;
+    while (!(SPSR & _BV(SPIF))) {
+    }
+    SPDR = hi;
+  }
+
+  uint8_t lo = pixelByte<progmem>(p + 1 - s);
+  while (!(SPSR & _BV(SPIF))) {
+  }
+  SPDR = lo;
+  while (!(SPSR & _BV(SPIF))) {
+  }
+}
+#endif
+
+/*!
+    @brief  Writes pixels already in the display's byte order, '565' RGB
+            with the most significant byte first, e.g. straight from a file.
+    @param  bytes  The 2 * num bytes of the pixels.
+    @param  num   Number of pixels to draw.
+*/
+void TFT_SPI::writePixels(const uint8_t *bytes, uint32_t num) {
+  num = takePixels(num);
+  DC_HIGH();
+  TFT_STAT_BYTES(2 * num);
+
+#if TFT_SPDR_BLIT
+  if (num > 0) streamPixels<false, false>(bytes, num);
+#else
+  while (num > 0) {
+    writeSPI(*bytes++);
+    writeSPI(*bytes++);
+    TFT_TRACE(run((bytes[-2] << 8) | bytes[-1], 1));
+    num--;
+  }
 #endif
 }
 
 /*!
-    @brief  Does the actual writing of 8-bit Data or Command. To write a command
-            chipset pin must set to low and otherwise when sending data.
-    @param c 8-bit Data/Command to be executed.
-    @returns an output if any exists. To read the output registers, the NOP
-              should be used.
+    @brief  Same as writePixels() for pixels in PROGMEM, e.g. an image
+            converted by extras/image_header.py.
+    @param  bytes  The 2 * num bytes of the pixels, in PROGMEM.
+    @param  num   Number of pixels to draw.
 */
-uint8_t TFT_SPI::writeSPI(uint8_t c) { return hwspi._spi->transfer(c); }
+void TFT_SPI::writePixels_P(const uint8_t *bytes, uint32_t num) {
+  num = takePixels(num);
+  DC_HIGH();
+  TFT_STAT_BYTES(2 * num);
+
+#if TFT_SPDR_BLIT
+  if (num > 0) streamPixels<true, false>(bytes, num);
+#else
+  while (num > 0) {
+    uint8_t hi = pgm_read_byte(bytes++);
+    uint8_t lo = pgm_read_byte(bytes++);
+    writeSPI(hi);
+    writeSPI(lo);
+    TFT_TRACE(run((hi << 8) | lo, 1));
+    num--;
+  }
+#endif
+}
+#endif
 
 /*!
     @brief  Sets the data transfer mode to Command, Activates the chip-select
@@ -149,9 +326,11 @@ uint8_t TFT_SPI::writeSPI(uint8_t c) { return hwspi._spi->transfer(c); }
     @param  cmd  8-bit command to write.
 */
 void TFT_SPI::writeCommand(uint8_t cmd) {
-  digitalWrite(_dc, LOW);
+  DC_LOW();
 
   writeSPI(cmd);
+  TFT_STAT_BYTES(1);
+  TFT_TRACE(command(cmd));
 }
 
 /*!
@@ -163,9 +342,11 @@ void TFT_SPI::writeCommand(uint8_t cmd) {
     @param  d8  8-bit Data to write.
 */
 void TFT_SPI::writeData(uint8_t d8) {
-  digitalWrite(_dc, HIGH);
+  DC_HIGH();
 
   writeSPI(d8);
+  TFT_STAT_BYTES(1);
+  TFT_TRACE(data(d8));
 }
 
 /*!
@@ -177,31 +358,127 @@ void TFT_SPI::writeData(uint8_t d8) {
     @param  num   Number of pixels to draw.
 */
 void TFT_SPI::writeData16(uint16_t color, uint32_t num) {
-  digitalWrite(_dc, HIGH);
+  num = takePixels(num);
+  DC_HIGH();
+  TFT_STAT_BYTES(2 * num);
+  TFT_TRACE(run(color, num));
 
+#if TFT_TRANSFER_CHUNK
+  while (num > 0) {
+    uint16_t chunk = num > TFT_TRANSFER_CHUNK ? TFT_TRANSFER_CHUNK : num;
+    num -= chunk;
+
+    while (chunk > 0) {
+      writeSPI(color >> 8);
+      writeSPI(color);
+      chunk--;
+    }
+
+    if (num > 0) transferBreak();
+  }
+#else
   while (num > 0) {
     writeSPI(color >> 8);
     writeSPI(color);
     num--;
   }
+#endif
 }
 
+#if TFT_ENABLE_IMAGES
 /*!
     @brief Similar to writeData16() but is optimised for pointers.
     @param  img  16-bit pixel color location pointer.
     @param  num   Number of pixels to draw.
     @note This is a fast method to send multiple 16-bit values from RAM via SPI
 */
-void TFT_SPI::writeImage(uint16_t *img, uint32_t num) {
-  digitalWrite(_dc, HIGH);
+void TFT_SPI::writeImage(const uint16_t *img, uint32_t num) {
+  num = takePixels(num);
+  DC_HIGH();
+  TFT_STAT_BYTES(2 * num);
+
+#if TFT_SPDR_BLIT
+  if (num > 0) streamPixels<false, true>((const uint8_t *)img, num);
+#else
   uint16_t color;
 
   while (num > 0) {
-    color = *img;
+    color = *img++;
     writeSPI(color >> 8);
     writeSPI(color);
+    TFT_TRACE(run(color, 1));
     num--;
   }
+#endif
+}
+#endif
+
+/*!
+    @brief  Limits the pixel writes that follow to the area of the window
+            just opened for memory write. The limit is lifted by the next
+            SPI_START(), it outlives SPI_END() for continueWrite().
+            Windows reaching past the display are counted as window errors
+            and only their on-screen part is allowed.
+    @param  x1  Start Column (SC)
+    @param  y1  Start Page (SP)
+    @param  x2  End Column (EC)
+    @param  y2  End Page (EP)
+*/
+void TFT_SPI::setPixelBudget(uint16_t x1, uint16_t y1, uint16_t x2,
+                             uint16_t y2) {
+  if (x2 >= _width || y2 >= _height) {
+    windowError();
+    if (x2 >= _width) x2 = _width - 1;
+    if (y2 >= _height) y2 = _height - 1;
+  }
+
+  if (x1 > x2 || y1 > y2) {
+    windowError();
+    _pixelsLeft = 0;
+    return;
+  }
+
+  _pixelsLeft = (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+}
+
+/*!
+    @brief  Takes pixels from the current window's budget. A request for more
+            pixels than are left is cut short and counted as a window error,
+            so a bad count cannot keep the bus busy for seconds.
+    @param  num  Number of pixels the caller wants to write.
+    @return Number of pixels that may be written.
+*/
+uint32_t TFT_SPI::takePixels(uint32_t num) {
+  if (_pixelsLeft == TFT_UNBOUNDED) return num;  // Not writing to a window.
+
+  if (num > _pixelsLeft) {
+    windowError();
+    num = _pixelsLeft;
+  }
+
+  _pixelsLeft -= num;
+  return num;
+}
+
+/*!
+    @brief  Counts a window error, saturating instead of wrapping around.
+*/
+void TFT_SPI::windowError(void) {
+  if (_windowErrors < 0xFFFF) _windowErrors++;
+}
+
+/*!
+    @brief  Runs between two TFT_TRANSFER_CHUNK sized chunks of a transfer.
+            Gives yield() a chance to run and kicks the watchdog, the transfer
+            itself being bounded by the window's area.
+    @note   The bus is still held with the chip selected: yield() handlers
+            must not use the SPI bus.
+*/
+void TFT_SPI::transferBreak(void) {
+  yield();
+#if defined(__AVR__)
+  wdt_reset();
+#endif
 }
 
 // -------------------------------------------------------------------------
@@ -213,19 +490,36 @@ void TFT_SPI::writeImage(uint16_t *img, uint32_t num) {
               should be managed by its' caller. It is done to increase its
               efficiency where data write need to be executed consecutively.
       @param   cmd  The command byte
-      @param   dataBytes  A pointer to the Data bytes to send
+      @param   dataBytes  A pointer to the Data bytes in RAM to send
       @param   numBytes  The number of bytes we should send
 */
 void TFT_SPI::sendCommand(uint8_t cmd, const uint8_t *dataBytes,
                           uint8_t numBytes) {
   writeCommand(cmd);  // Set commmand mode and execute the command input.
 
+  for (uint8_t i = 0; i < numBytes; i++) {
+    writeData(*dataBytes++);  // Set data mode and send the data bytes
+  }
+}
+
+/*!
+      @brief  Similar to sendCommand() but the data bytes are read from the
+              program memory (PROGMEM) instead of RAM.
+      @param   cmd  The command byte
+      @param   dataBytes  A pointer to the Data bytes in PROGMEM to send
+      @param   numBytes  The number of bytes we should send
+*/
+void TFT_SPI::sendCommand_P(uint8_t cmd, const uint8_t *dataBytes,
+                            uint8_t numBytes) {
+  writeCommand(cmd);  // Set commmand mode and execute the command input.
+
   for (uint8_t i = 0; i < numBytes; i++) {
     uint8_t data = pgm_read_byte(dataBytes++);
     writeData(data);  // Set data mode and send the data bytes
   }
 }
 
+#if TFT_ENABLE_READBACK
 /*!
     @brief   Reads 8 bits of data from display configuration memory (not RAM).
             It does not initiate or close the SPI communication session. This
@@ -241,7 +535,9 @@ void TFT_SPI::sendCommand(uint8_t cmd, const uint8_t *dataBytes,
 uint8_t TFT_SPI::readcommand8(uint8_t commandByte, uint8_t index) {
   writeCommand(commandByte);
 
-  pinMode(_dc, HIGH);  // Data Mode; should not be used often.
+  DC_HIGH();  // Data Mode; should not be used often.
+  TFT_STAT_BYTES(index + 1);
+  TFT_TRACE(read(index + 1));
   uint8_t result;
 
   do {
@@ -250,3 +546,16 @@ uint8_t TFT_SPI::readcommand8(uint8_t commandByte, uint8_t index) {
 
   return result;
 }
+
+/*!
+    @brief   Reads a single 8-bit data byte by clocking out a NOP. The read
+             command must already have been sent; it does not initiate or
+             close the SPI communication session.
+    @return  The data byte read from the display.
+*/
+uint8_t TFT_SPI::readData(void) {
+  TFT_STAT_BYTES(1);
+  TFT_TRACE(read(1));
+  return writeSPI(0x00);
+}
+#endif
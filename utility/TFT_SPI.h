@@ -26,6 +26,7 @@
 #include <SPI.h>
 
 #include "TFT_GFX.h"
+#include "TFT_Trace.h"
 
 // HARDWARE CONFIG
 // -----------------------------------------------------------------------------
@@ -36,9 +37,38 @@
 #define DEFAULT_SPI_FREQ 16000000L  ///< Hardware SPI default speed
 #endif
 
+#ifndef TFT_READ_FREQ
+#define TFT_READ_FREQ 6000000L  ///< Read clock, reads need a 150 ns cycle.
+#endif
+
 #define TFT_WIDTH 240   ///< Maximum TFT display hardware width.
 #define TFT_HEIGHT 320  ///< Maximum TFT display hardware height.
 
+#define TFT_UNBOUNDED 0xFFFFFFFFUL  ///< No pixel budget outside a window.
+
+#ifndef TFT_SPDR_BLIT
+#if defined(__AVR__) && !TFT_ENABLE_TRACE
+#define TFT_SPDR_BLIT 1  ///< Image writes feed SPDR without SPI.transfer().
+#else
+#define TFT_SPDR_BLIT 0  ///< Image writes go through SPI.transfer().
+#endif
+#endif
+
+#if TFT_ENABLE_STATS
+#define TFT_STAT_BYTES(n) (_spiBytes += (n))  ///< Counts bytes sent over SPI.
+#else
+#define TFT_STAT_BYTES(n)  ///< SPI byte counting is disabled.
+#endif
+
+#if TFT_ENABLE_TRACE
+#define TFT_TRACE(call) \
+  do {                    \
+    if (_trace) _trace->call; \
+  } while (0)  ///< Forwards an event to the attached trace.
+#else
+#define TFT_TRACE(call)  ///< SPI tracing is disabled.
+#endif
+
 // CLASS DEFINITION
 // -----------------------------------------------------------------------------
 
@@ -47,6 +77,10 @@
   hardware-specific subclasses.
 */
 class TFT_SPI : public TFT_GFX {
+  friend class TFT_Wall;   // Drives each tiled panel's address window.
+  friend class TFT_Touch;  // Shares the SPI bus between transactions.
+  friend class TFT_SRAM;   // Streams the SRAM into an open window.
+
  public:
   // CONSTRUCTOR
   // ---------------------------------------------------------------------------
@@ -66,13 +100,9 @@ class TFT_SPI : public TFT_GFX {
 
   virtual ~TFT_SPI(){};
 
- private:
-  // PRIVATE CLASS MEMBER FUNCTIONS
+  // TRANSACTION API
   // ---------------------------------------------------------------------------
 
-  uint8_t writeSPI(uint8_t c);
-
- protected:
   /*!
       @brief  Sets up the specific display hardware's "address window"
               for subsequent pixel-pushing operations.
@@ -87,20 +117,121 @@ class TFT_SPI : public TFT_GFX {
   */
   virtual void setAddressWindow(uint16_t x, uint16_t y, uint16_t w,
                                 uint16_t h) = 0;
-  void writeData(uint8_t data);    // Write single byte as DATA
-  void writeCommand(uint8_t cmd);  // Write single byte as Command
   void writeData16(uint16_t color,
                    uint32_t len);  // Writes 16 bit for provided counts.
+  void endWrite(void);             // Ends the setAddressWindow() transaction.
+#if TFT_ENABLE_IMAGES
+  void writePixels(const uint8_t *bytes, uint32_t num);  // Big-endian 565.
+  void writePixels_P(const uint8_t *bytes, uint32_t num);  // From PROGMEM.
+#endif
+
+  void setWriteClock(uint32_t freq);
+  void setReadClock(uint32_t freq);
+
+  /*!
+      @brief  Returns the clock of the write transactions.
+      @return SPI clock in Hz as requested, the hardware may round it down.
+  */
+  uint32_t writeClock(void) const { return _writeFreq; }
+
+  /*!
+      @brief  Returns the clock of the read transactions.
+      @return SPI clock in Hz as requested, the hardware may round it down.
+  */
+  uint32_t readClock(void) const { return _readFreq; }
 
-  void writeImage(uint16_t *img, uint32_t num);  // Writes image efficiently
+  /*!
+      @brief  Returns the number of window errors caught since the last
+              clearWindowErrors() call: windows outside the display and pixel
+              writes past the end of the current window.
+      @return Window errors, saturating at 65535.
+  */
+  uint16_t windowErrors(void) const { return _windowErrors; }
+
+  /*!
+      @brief  Restarts the window error count from zero.
+  */
+  void clearWindowErrors(void) { _windowErrors = 0; }
+
+#if TFT_ENABLE_STATS
+  /*!
+      @brief  Returns the number of bytes sent over SPI since the last
+              resetSPIBytes() call.
+      @return Command, parameter and pixel bytes written.
+  */
+  uint32_t spiBytes(void) const { return _spiBytes; }
+
+  /*!
+      @brief  Restarts the SPI byte count from zero.
+  */
+  void resetSPIBytes(void) { _spiBytes = 0; }
+#endif
+
+#if TFT_ENABLE_TRACE
+  /*!
+      @brief  Attaches a trace recording every byte sent to the display.
+      @param  trace  The trace to record to, NULL to stop recording.
+  */
+  void setTrace(TFT_Trace *trace) { _trace = trace; }
+#endif
+
+ private:
+  // PRIVATE CLASS MEMBER FUNCTIONS
+  // ---------------------------------------------------------------------------
+
+  /*!
+      @brief  Does the actual writing of 8-bit Data or Command.
+      @param  c  8-bit Data/Command to be executed.
+      @return The byte clocked in while `c` was shifted out.
+  */
+  uint8_t writeSPI(uint8_t c) { return hwspi._spi->transfer(c); }
+
+  uint32_t takePixels(uint32_t num);  // Clamps num to the window's pixels.
+  void windowError(void);             // Counts a window error.
+  void transferBreak(void);           // Yields between transfer chunks.
+
+ protected:
+  void writeData(uint8_t data);    // Write single byte as DATA
+  void writeCommand(uint8_t cmd);  // Write single byte as Command
+
+#if TFT_ENABLE_IMAGES
+  void writeImage(const uint16_t *img, uint32_t num);  // Writes image fast
+#endif
 
   void initSPI(uint32_t freq = 0, uint8_t spiMode = SPI_MODE0);
   void sendCommand(uint8_t cmd, const uint8_t *dataBytes, uint8_t numBytes);
+  void sendCommand_P(uint8_t cmd, const uint8_t *dataBytes, uint8_t numBytes);
+#if TFT_ENABLE_READBACK
   uint8_t readcommand8(uint8_t commandByte, uint8_t index);
+  uint8_t readData(void);  // Read single byte of DATA
+#endif
 
   void SPI_START();
+  void SPI_START_READ();
   void SPI_END();
 
+  void setPixelBudget(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+  /*!
+      @brief  Drives the pin to the given level. On AVR the pin's PORT
+              register is written directly instead of calling digitalWrite().
+  */
+#if defined(__AVR__)
+  void DC_LOW(void) { *_dcPort &= ~_dcPinMask; }
+  void DC_HIGH(void) { *_dcPort |= _dcPinMask; }
+  void CS_LOW(void) { *_csPort &= ~_csPinMask; }
+  void CS_HIGH(void) { *_csPort |= _csPinMask; }
+#else
+  void DC_LOW(void) { digitalWrite(_dc, LOW); }
+  void DC_HIGH(void) { digitalWrite(_dc, HIGH); }
+  void CS_LOW(void) {
+    if (_cs >= 0) digitalWrite(_cs, LOW);
+  }
+  void CS_HIGH(void) {
+    if (_cs >= 0) digitalWrite(_cs, HIGH);
+  }
+#endif
+
   // CLASS INSTANCE VARIABLES
   // ---------------------------------------------------------------------------
 #if defined(__cplusplus) && (__cplusplus >= 201100)
@@ -111,7 +242,8 @@ class TFT_SPI : public TFT_GFX {
       SPIClass *_spi;  ///< SPI class pointer
 
 #if defined(SPI_HAS_TRANSACTION)
-      SPISettings settings;  ///< SPI transaction settings
+      SPISettings settings;      ///< SPI transaction settings
+      SPISettings readSettings;  ///< Settings of the transactions reading back
 #endif
     } hwspi;  ///< Hardware SPI values
 
@@ -123,8 +255,31 @@ class TFT_SPI : public TFT_GFX {
   int8_t _cs;   ///< Chip select pin # (or -1)
   int8_t _dc;   ///< Data/command pin #
 
+#if defined(__AVR__)
+  volatile uint8_t *_dcPort;  ///< PORT register for data/command pin
+  volatile uint8_t *_csPort;  ///< PORT register for chip select pin
+  uint8_t _dcPinMask;         ///< Bitmask for data/command pin
+  uint8_t _csPinMask;         ///< Bitmask for chip select pin
+#endif
+
   uint16_t WIDTH;
   uint16_t HEIGHT;
+
+  uint32_t _writeFreq;  ///< Clock of the write transactions.
+  uint32_t _readFreq;   ///< Clock of the read transactions.
+  uint8_t _spiMode;     ///< SPI mode of both.
+
+  bool _inTransaction;     ///< Between SPI_START() and SPI_END().
+  uint32_t _pixelsLeft;    ///< Pixels left in the current window.
+  uint16_t _windowErrors;  ///< Window errors caught, see windowErrors().
+
+#if TFT_ENABLE_STATS
+  uint32_t _spiBytes;  ///< Bytes sent over SPI, counted per call.
+#endif
+
+#if TFT_ENABLE_TRACE
+  TFT_Trace *_trace;  ///< Trace recording the SPI traffic, or NULL.
+#endif
 };
 
 #endif  // end _TFT_SPI_H_
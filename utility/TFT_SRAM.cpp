@@ -0,0 +1,268 @@
+/*!
+ * @file TFT_SRAM.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "TFT_SRAM.h"
+
+#if TFT_ENABLE_IMAGES
+
+/*!
+    @brief   TFT_SRAM constructor.
+    @param   panel  Display sharing the SPI bus with the SRAM.
+    @param   cs     Arduino pin # for the SRAM chip select.
+    @param   w      Canvas width in pixels, 320 at most.
+    @param   h      Canvas height in pixels, cut to what fits in the SRAM
+                    (TFT_SRAM_BYTES) and to 320 rows.
+*/
+TFT_SRAM::TFT_SRAM(TFT_SPI &panel, int8_t cs, uint16_t w, uint16_t h)
+    : TFT_GFX(w, h), _panel(panel), _cs(cs) {
+  if (_width > TFT_HEIGHT) _width = TFT_HEIGHT;
+  uint32_t rows = _width ? TFT_SRAM_BYTES / (2UL * _width) : 0;
+  if (_height > rows) _height = rows;
+  if (_height > TFT_HEIGHT) _height = TFT_HEIGHT;
+
+#if defined(SPI_HAS_TRANSACTION)
+  _settings = SPISettings(TFT_SRAM_FREQ, MSBFIRST, SPI_MODE0);
+#endif
+
+  _duplex = true;
+  _x1 = _y1 = _x2 = _y2 = 0;
+  _cx = _cy = 0;
+  memset(_dirty, 0, sizeof(_dirty));
+}
+
+/*!
+    @brief  Configures the chip select pin and puts the SRAM in sequential
+            mode. Call it before the display's begin() so that the SRAM
+            doesn't listen to the display's initialisation.
+    @return true if the SRAM answered with the mode just written.
+*/
+bool TFT_SRAM::begin(void) {
+  pinMode(_cs, OUTPUT);
+  deselect();
+
+  SPIClass *spi = _panel.hwspi._spi;
+  spi->begin();
+
+#if defined(SPI_HAS_TRANSACTION)
+  spi->beginTransaction(_settings);
+#endif
+  digitalWrite(_cs, LOW);
+  spi->transfer(SRAM_WRMR);
+  spi->transfer(SRAM_SEQUENTIAL);
+  deselect();
+
+  digitalWrite(_cs, LOW);
+  spi->transfer(SRAM_RDMR);
+  uint8_t mode = spi->transfer(0x00);
+  deselect();
+#if defined(SPI_HAS_TRANSACTION)
+  spi->endTransaction();
+#endif
+
+  return mode == SRAM_SEQUENTIAL;
+}
+
+/*!
+    @brief  Copies the rows drawn since the last flush to the display, one
+            address window per run of dirty rows.
+    @param  x  Display column of the canvas's left edge.
+    @param  y  Display row of the canvas's top edge.
+    @return false if the canvas doesn't fit on the display at (x, y) at its
+            current rotation, nothing is copied then.
+*/
+bool TFT_SRAM::flush(uint16_t x, uint16_t y) {
+  if ((uint32_t)x + _width > _panel.width() ||
+      (uint32_t)y + _height > _panel.height())
+    return false;
+
+  uint16_t row = 0;
+  while (row < _height) {
+    if (!isDirty(row)) {
+      row++;
+      continue;
+    }
+
+    uint16_t last = row;
+    while (last + 1 < _height && isDirty(last + 1)) last++;
+
+    copyRows(x, y, row, last);
+    row = last + 1;
+  }
+
+  memset(_dirty, 0, sizeof(_dirty));
+  return true;
+}
+
+/*!
+    @brief  Marks the whole canvas dirty, e.g. after something else was drawn
+            over it on the display, so the next flush() copies every row.
+*/
+void TFT_SRAM::invalidate(void) { memset(_dirty, 0xFF, sizeof(_dirty)); }
+
+/*!
+    @brief   Stores the address window the next pixels are written to.
+    @param   x1  Start column.
+    @param   y1  Start row.
+    @param   x2  End column.
+    @param   y2  End row.
+*/
+void TFT_SRAM::setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2,
+                                uint16_t y2) {
+  _x1 = _cx = x1;
+  _y1 = _cy = y1;
+  _x2 = x2;
+  _y2 = y2;
+}
+
+/*!
+    @brief  Writes pixels of one color to the SRAM, filling the window row
+            by row from where the last call stopped. A window as wide as the
+            canvas is contiguous in the SRAM and written in one sequential
+            write, others take one per row.
+    @param  color  16-bit pixel color in '565' RGB format.
+    @param  num   Number of pixels to draw.
+*/
+void TFT_SRAM::writeData16(uint16_t color, uint32_t num) {
+  if (_x2 >= _width || _y2 >= _height || _x1 > _x2) return;
+
+  SPIClass *spi = _panel.hwspi._spi;
+  bool contiguous = _x1 == 0 && _x2 == _width - 1;
+
+#if defined(SPI_HAS_TRANSACTION)
+  spi->beginTransaction(_settings);
+#endif
+  while (num > 0 && _cy <= _y2) {
+    uint32_t pos = (uint32_t)_cy * _width + _cx;
+    uint32_t n = _x2 - _cx + 1;  // Up to the end of the row.
+    if (contiguous) n = (uint32_t)(_y2 + 1) * _width - pos;
+    if (n > num) n = num;
+    num -= n;
+
+    markDirty(_cy, (pos + n - 1) / _width);
+    pos += n;
+    if (contiguous) {
+      _cy = pos / _width;
+      _cx = pos % _width;
+    } else if ((_cx += n) > _x2) {
+      _cx = _x1;
+      _cy++;
+    }
+
+    select(SRAM_WRITE, 2 * (pos - n));
+    while (n > 0) {
+      spi->transfer(color >> 8);
+      spi->transfer(color);
+      n--;
+    }
+    deselect();
+  }
+#if defined(SPI_HAS_TRANSACTION)
+  spi->endTransaction();
+#endif
+}
+
+/*!
+    @brief  Ends the window. Nothing to do, each run of pixels was already
+            written in its own SRAM transaction.
+*/
+void TFT_SRAM::endWrite(void) {}
+
+/*!
+    @brief  Selects the SRAM and sends a command and its 24-bit address.
+    @param  cmd  SRAM_READ or SRAM_WRITE.
+    @param  addr  First byte read or written.
+*/
+void TFT_SRAM::select(uint8_t cmd, uint32_t addr) {
+  SPIClass *spi = _panel.hwspi._spi;
+
+  digitalWrite(_cs, LOW);
+  spi->transfer(cmd);
+  spi->transfer(addr >> 16);
+  spi->transfer(addr >> 8);
+  spi->transfer(addr);
+}
+
+/*!
+    @brief  Marks rows as changed since the last flush.
+    @param  y1  First row.
+    @param  y2  Last row.
+*/
+void TFT_SRAM::markDirty(uint16_t y1, uint16_t y2) {
+  for (uint16_t row = y1; row <= y2; row++) {
+    _dirty[row >> 3] |= 1 << (row & 7);
+  }
+}
+
+/*!
+    @brief  Copies full rows of the canvas to the display in one window. The
+            display's chip select is raised while the SRAM is addressed,
+            which doesn't end its Memory Write.
+    @param  x  Display column of the canvas's left edge.
+    @param  y  Display row of the canvas's top edge.
+    @param  y1  First canvas row.
+    @param  y2  Last canvas row.
+*/
+void TFT_SRAM::copyRows(uint16_t x, uint16_t y, uint16_t y1, uint16_t y2) {
+  SPIClass *spi = _panel.hwspi._spi;
+  uint32_t addr = 2UL * y1 * _width;
+  uint32_t bytes = 2UL * (y2 - y1 + 1) * _width;
+
+  _panel.setAddressWindow(x, y + y1, x + _width - 1, y + y2);
+  _panel.DC_HIGH();
+  _panel.CS_HIGH();
+
+  if (_duplex) {
+    _panel.takePixels(bytes / 2);
+#if TFT_ENABLE_STATS
+    _panel._spiBytes += bytes;
+#endif
+
+    // The SRAM ignores MOSI once reading, so with both chips selected the
+    // display takes byte n while the SRAM sends byte n + 1.
+    select(SRAM_READ, addr);
+    uint8_t b = spi->transfer(0x00);
+    _panel.CS_LOW();
+    while (--bytes > 0) b = spi->transfer(b);
+    deselect();
+    spi->transfer(b);
+  } else {
+    uint8_t buf[TFT_SRAM_CHUNK];
+    while (bytes > 0) {
+      uint16_t n = bytes > TFT_SRAM_CHUNK ? TFT_SRAM_CHUNK : bytes;
+
+      select(SRAM_READ, addr);
+      for (uint16_t i = 0; i < n; i++) buf[i] = spi->transfer(0x00);
+      deselect();
+
+      _panel.CS_LOW();
+      _panel.writePixels(buf, n / 2);
+      _panel.CS_HIGH();
+
+      addr += n;
+      bytes -= n;
+    }
+    _panel.CS_LOW();
+  }
+
+  _panel.endWrite();
+}
+
+#endif  // end TFT_ENABLE_IMAGES
@@ -0,0 +1,126 @@
+/*!
+ * @file TFT_SRAM.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_SRAM_H_
+#define _TFT_SRAM_H_
+
+#include "TFT_SPI.h"
+
+#if TFT_ENABLE_IMAGES
+
+#ifndef TFT_SRAM_FREQ
+#define TFT_SRAM_FREQ 20000000L  ///< 23LC1024 SPI clock, 20 MHz at most.
+#endif
+
+#ifndef TFT_SRAM_BYTES
+#define TFT_SRAM_BYTES 131072UL  ///< SRAM size, 65536UL for a 23LC512.
+#endif
+
+#ifndef TFT_SRAM_CHUNK
+#define TFT_SRAM_CHUNK 64  ///< Half-duplex flush stack buffer, even bytes.
+#endif
+
+#define SRAM_READ 0x03        ///< Read from the address, sequentially.
+#define SRAM_WRITE 0x02       ///< Write from the address, sequentially.
+#define SRAM_RDMR 0x05        ///< Read Mode Register.
+#define SRAM_WRMR 0x01        ///< Write Mode Register.
+#define SRAM_SEQUENTIAL 0x40  ///< Mode: the address runs over the whole chip.
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_SRAM is a TFT_GFX canvas kept in a 23LC1024 serial SRAM sharing
+          the display's SPI bus. Drawing only touches the SRAM, rows written
+          since the last flush are marked dirty and flush() copies them to
+          the display, one window per run of dirty rows.
+
+          128 KB hold 273 rows of 240 pixels, or 204 rows of 320. Pixels are
+          stored row by row in the display's byte order, so a run of rows is
+          one sequential SRAM read. By default the flush selects both chips
+          at once: each byte clocked out to the display on MOSI clocks the
+          next one in from the SRAM on MISO, so reading and writing fully
+          overlap. The display must leave MISO floating while written to, as
+          the ILI9341 does; setDuplex(false) reads chunks into RAM instead
+          for modules that don't.
+
+  @code
+    TFT_SRAM back(tft, SRAM_CS, 240, 273);
+    back.begin();  // Before tft.begin().
+    back.fillScreen(ILI9341_BLACK);
+    back.drawShape(70, 86, 100, 100, 50, 2, ILI9341_RED, ILI9341_BLUE);
+    back.flush(0, 0);  // Only the dirty rows.
+  @endcode
+*/
+class TFT_SRAM : public TFT_GFX {
+ public:
+  // CONSTRUCTOR
+  // ---------------------------------------------------------------------------
+
+  TFT_SRAM(TFT_SPI &panel, int8_t cs, uint16_t w, uint16_t h);
+
+  // DESTRUCTOR
+  // ---------------------------------------------------------------------------
+
+  virtual ~TFT_SRAM(){};
+
+  bool begin(void);
+  bool flush(uint16_t x, uint16_t y);
+  void invalidate(void);
+
+  /*!
+      @brief  Chooses how flush() reads the SRAM.
+      @param  duplex  true to overlap the SRAM reads with the display
+                      writes, false to read chunks into RAM first.
+  */
+  void setDuplex(bool duplex) { _duplex = duplex; }
+
+ protected:
+  void setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+  void writeData16(uint16_t color, uint32_t num);
+  void endWrite(void);
+
+ private:
+  void select(uint8_t cmd, uint32_t addr);
+  void deselect(void) { digitalWrite(_cs, HIGH); }
+  void markDirty(uint16_t y1, uint16_t y2);
+  bool isDirty(uint16_t row) const {
+    return _dirty[row >> 3] & (1 << (row & 7));
+  }
+  void copyRows(uint16_t x, uint16_t y, uint16_t y1, uint16_t y2);
+
+  TFT_SPI &_panel;  ///< Display the canvas is flushed to.
+  int8_t _cs;       ///< SRAM chip select pin #.
+  bool _duplex;     ///< Overlapped flush, see setDuplex().
+
+#if defined(SPI_HAS_TRANSACTION)
+  SPISettings _settings;  ///< SRAM bus settings.
+#endif
+
+  uint16_t _x1, _y1, _x2, _y2;  ///< Current address window.
+  uint16_t _cx, _cy;            ///< Next pixel written in the window.
+
+  uint8_t _dirty[(TFT_HEIGHT + 7) / 8];  ///< Bit per row to flush.
+};
+
+#endif  // end TFT_ENABLE_IMAGES
+
+#endif  // end _TFT_SRAM_H_
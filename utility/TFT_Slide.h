@@ -0,0 +1,167 @@
+/*!
+ * @file TFT_Slide.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_SLIDE_H_
+#define _TFT_SLIDE_H_
+
+#include "TFT_SPI.h"
+
+#ifndef TFT_SLIDE_FRAME_US
+#define TFT_SLIDE_FRAME_US 12658  ///< One panel frame at the 79 Hz of begin().
+#endif
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Slide slides a new page over the current one using the display's
+          hardware scrolling. The whole display is the scroll area: every
+          frame it scrolls by a few lines and only the strip of the new page
+          that scrolled into view is drawn, over the old page's lines that
+          just left the screen. Lines of both pages stay where they are drawn,
+          so the new page is drawn with the usual coordinates and the scroll
+          offset is back to 0 once the slide is over.
+
+          Lines are rows in portrait and columns in landscape, where the
+          pages slide sideways (see AVR_ILI9341::getScrollAxis()). The strip
+          callback must only draw within the lines it is given, any other
+          line drawn shows up over the visible pages.
+
+  @code
+    TFT_Slide<AVR_ILI9341> slide(tft);
+
+    void drawStrip(uint16_t y, uint16_t h) {
+      tft.drawShape(0, y, 240, h, 0, 0, ILI9341_BLUE, ILI9341_BLUE);
+    }
+
+    slide.start(TFT_Slide<AVR_ILI9341>::Up, drawStrip);
+    while (slide.service()) {
+      // ... other work ...
+    }
+  @endcode
+*/
+template <class Device>
+class TFT_Slide {
+ public:
+  /*!
+      @brief  Direction the new page moves in, or right to left and left to
+              right in landscape.
+  */
+  enum Direction {
+    Up,   ///< The new page comes in from the bottom (right) edge.
+    Down  ///< The new page comes in from the top (left) edge.
+  };
+
+  /*!
+      @brief  Draws lines pos to pos + len - 1 of the new page: rows in
+              portrait, columns in landscape.
+  */
+  typedef void (*DrawStrip)(uint16_t pos, uint16_t len);
+
+  /*!
+      @brief  Binds the transition engine to a device.
+      @param  dev  The device scrolled, at any rotation.
+  */
+  explicit TFT_Slide(Device &dev) : _dev(dev), _draw(NULL) {}
+
+  bool start(Direction dir, DrawStrip draw, uint8_t step = 8,
+             uint32_t frameUs = TFT_SLIDE_FRAME_US);
+  bool service(void);
+
+  /*!
+      @brief  Tells whether a slide is in progress.
+      @return true until the last strip of the new page has been drawn.
+  */
+  bool running(void) const { return _draw != NULL; }
+
+ private:
+  Device &_dev;        ///< Device scrolled.
+  DrawStrip _draw;     ///< Strip callback, NULL when no slide is running.
+  Direction _dir;      ///< Direction of the running slide.
+  uint8_t _step;       ///< Lines scrolled per frame.
+  uint16_t _shown;     ///< Lines of the new page on the screen.
+  uint32_t _frameUs;   ///< Microseconds between two steps.
+  uint32_t _lastStep;  ///< micros() at the last step.
+};
+
+/*!
+    @brief  Starts sliding a new page in. The scroll area is reset to the
+            whole display and the first step is taken by the next service().
+    @param  dir  Direction the new page moves in.
+    @param  draw  Draws the strips of the new page.
+    @param  step  Lines scrolled per frame, the slide lasts 320 / step frames.
+    @param  frameUs  Microseconds between two steps, one panel frame by
+                     default.
+    @return false if draw is NULL.
+*/
+template <class Device>
+bool TFT_Slide<Device>::start(Direction dir, DrawStrip draw, uint8_t step,
+                              uint32_t frameUs) {
+  if (draw == NULL) return false;
+
+  _dev.setScrollArea(0, TFT_HEIGHT);
+  _dev.scrollArea(0);
+
+  _draw = draw;
+  _dir = dir;
+  _step = step > 0 ? step : 1;
+  _shown = 0;
+  _frameUs = frameUs;
+  _lastStep = micros() - frameUs;
+  return true;
+}
+
+/*!
+    @brief  Takes the next step of the slide once a frame period has passed
+            since the last one: scrolls the new page in by `step` lines then
+            draws the strip that came into view. Call it from loop() as often
+            as possible.
+    @return true while the slide is running.
+    @note   The lines scrolled in show the old page's opposite edge until
+            their strip is drawn, for as long as the strip takes to draw.
+*/
+template <class Device>
+bool TFT_Slide<Device>::service(void) {
+  if (_draw == NULL) return false;
+
+  uint32_t now = micros();
+  if (now - _lastStep < _frameUs) return true;
+  _lastStep = now;
+
+  uint16_t from = _shown;
+  _shown = (TFT_HEIGHT - _shown > _step) ? _shown + _step : TFT_HEIGHT;
+  uint16_t rows = _shown - from;
+
+  if (_dir == Up) {
+    // Screen line l shows the line (_shown + l) % 320 drawn.
+    _dev.scrollArea(_shown);
+    _draw(from, rows);
+  } else {
+    // Screen line l shows the line (320 - _shown + l) % 320 drawn.
+    _dev.scrollArea(TFT_HEIGHT - _shown);
+    _draw(TFT_HEIGHT - _shown, rows);
+  }
+
+  if (_shown == TFT_HEIGHT) _draw = NULL;
+  return _draw != NULL;
+}
+
+#endif  // end _TFT_SLIDE_H_
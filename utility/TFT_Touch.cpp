@@ -0,0 +1,265 @@
+/*!
+ * @file TFT_Touch.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "TFT_Touch.h"
+
+TFT_Touch *TFT_Touch::_penTouch = NULL;
+
+/*!
+    @brief   TFT_Touch constructor.
+    @param   tft  Display sharing the SPI bus with the touch controller.
+    @param   cs   Arduino pin # for the touch controller chip select.
+    @param   irq  Arduino pin # for the PENIRQ output (-1 if not wired, the
+                  pressure is then measured to detect touches).
+*/
+TFT_Touch::TFT_Touch(TFT_SPI &tft, int8_t cs, int8_t irq)
+    : _tft(tft), _cs(cs), _irq(irq) {
+  _pen = false;
+
+#if defined(SPI_HAS_TRANSACTION)
+  _settings = SPISettings(TFT_TOUCH_FREQ, MSBFIRST, SPI_MODE0);
+#endif
+
+  // Usual raw range of the panels fitted on ILI9341 modules.
+  setCalibration(200, 3900, 200, 3900);
+}
+
+/*!
+    @brief  Configures the pins and deselects the touch controller. Call it
+            before the display's begin() so that the controller doesn't
+            listen to the display's initialisation. The PENIRQ interrupt is
+            attached when the pin has one and no other TFT_Touch uses it,
+            otherwise the pin is read.
+*/
+void TFT_Touch::begin(void) {
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_cs, HIGH);
+
+  if (_irq < 0) return;
+  pinMode(_irq, INPUT_PULLUP);
+
+  int8_t irqNum = digitalPinToInterrupt(_irq);
+  if (irqNum == NOT_AN_INTERRUPT || (_penTouch && _penTouch != this)) return;
+
+  _penTouch = this;
+  _pen = digitalRead(_irq) == LOW;  // Already pressed, no edge will come.
+  attachInterrupt(irqNum, penISR, FALLING);
+}
+
+/*!
+    @brief  Sets the raw readings at the display edges, at rotation 0. A
+            minimum above its maximum flips the axis.
+    @param  xMin  Raw X reading at column 0.
+    @param  xMax  Raw X reading at column 239.
+    @param  yMin  Raw Y reading at row 0.
+    @param  yMax  Raw Y reading at row 319.
+*/
+void TFT_Touch::setCalibration(uint16_t xMin, uint16_t xMax, uint16_t yMin,
+                               uint16_t yMax) {
+  _xMin = xMin;
+  _xMax = xMax;
+  _yMin = yMin;
+  _yMax = yMax;
+}
+
+/*!
+    @brief  Tells whether the panel is pressed. With PENIRQ wired only the
+            interrupt's latch or the pin is checked, without it the pressure
+            is measured over SPI.
+    @return true if the panel is pressed, or was tapped since the last call.
+*/
+bool TFT_Touch::touched(void) {
+  if (_irq >= 0) return penDown();
+
+  uint16_t z = 0;
+  readRaw(NULL, NULL, &z);
+  return z >= TFT_TOUCH_Z_MIN;
+}
+
+/*!
+    @brief  Samples the panel TFT_TOUCH_SAMPLES times. The extreme samples of
+            each axis are dropped and the others averaged. Noisy readings,
+            e.g. while the pen is landing or lifting, are rejected.
+    @param  x  Receives the raw X reading, may be NULL.
+    @param  y  Receives the raw Y reading, may be NULL.
+    @param  z  Receives the pressure, may be NULL.
+    @return false if the panel isn't pressed, the reading is noisy or the
+            display is in the middle of a transaction, e.g. when called from
+            yield() during a long transfer.
+*/
+bool TFT_Touch::readRaw(uint16_t *x, uint16_t *y, uint16_t *z) {
+  if (_tft._inTransaction) return false;  // Only between draw transactions.
+  if (_irq >= 0 && !penDown()) return false;
+
+  uint16_t xs[TFT_TOUCH_SAMPLES], ys[TFT_TOUCH_SAMPLES];
+
+#if defined(SPI_HAS_TRANSACTION)
+  _tft.hwspi._spi->beginTransaction(_settings);
+#endif
+  digitalWrite(_cs, LOW);
+
+  uint16_t pressure = readPressure();
+  if (pressure >= TFT_TOUCH_Z_MIN) {
+    for (uint8_t i = 0; i < TFT_TOUCH_SAMPLES; i++) {
+      xs[i] = readChannel(XPT2046_X);
+      ys[i] = readChannel(XPT2046_Y);
+    }
+
+    // The pen may have lifted while sampling.
+    uint16_t after = readPressure();
+    if (after < pressure) pressure = after;
+  }
+  readChannel(XPT2046_OFF);  // Powers down, enabling PENIRQ again.
+
+  digitalWrite(_cs, HIGH);
+#if defined(SPI_HAS_TRANSACTION)
+  _tft.hwspi._spi->endTransaction();
+#endif
+
+  if (z) *z = pressure;
+  if (pressure < TFT_TOUCH_Z_MIN) {
+    _pen = false;  // Drops the edges of the conversions themselves.
+    return false;
+  }
+
+  uint16_t rawX, rawY;
+  if (!filter(xs, &rawX) || !filter(ys, &rawY)) return false;
+
+  if (x) *x = rawX;
+  if (y) *y = rawY;
+  return true;
+}
+
+/*!
+    @brief  Reads the touched point in display coordinates at the display's
+            current rotation.
+    @param  x  Receives the column touched.
+    @param  y  Receives the row touched.
+    @return false if no point was read, see readRaw().
+*/
+bool TFT_Touch::read(uint16_t *x, uint16_t *y) {
+  uint16_t rawX, rawY;
+  if (_xMin == _xMax || _yMin == _yMax) return false;  // Not calibrated.
+  if (!readRaw(&rawX, &rawY, NULL)) return false;
+
+  // Scale to rotation 0 coordinates, clamped to the display.
+  int32_t x0 = ((int32_t)rawX - _xMin) * (TFT_WIDTH - 1) /
+               ((int32_t)_xMax - _xMin);
+  int32_t y0 = ((int32_t)rawY - _yMin) * (TFT_HEIGHT - 1) /
+               ((int32_t)_yMax - _yMin);
+  x0 = constrain(x0, 0, TFT_WIDTH - 1);
+  y0 = constrain(y0, 0, TFT_HEIGHT - 1);
+
+  // Follow the display's MADCTL for its rotation, see setRotation().
+  switch (_tft.getRotation()) {
+    case 0:
+      *x = x0;
+      *y = y0;
+      break;
+    case 1:
+      *x = y0;
+      *y = (TFT_WIDTH - 1) - x0;
+      break;
+    case 2:
+      *x = (TFT_WIDTH - 1) - x0;
+      *y = (TFT_HEIGHT - 1) - y0;
+      break;
+    case 3:
+      *x = (TFT_HEIGHT - 1) - y0;
+      *y = x0;
+      break;
+  }
+  return true;
+}
+
+/*!
+    @brief  Tells whether PENIRQ reported a press. With the interrupt, the
+            latch is read and only re-armed from the pin once set, so an
+            idle panel costs nothing and a tap is reported once.
+    @return true if the pen is down or came down since the last call.
+*/
+bool TFT_Touch::penDown(void) {
+  if (_penTouch != this) return digitalRead(_irq) == LOW;
+  if (!_pen) return false;
+
+  // Cleared before the pin is read: an edge in between sets it again.
+  _pen = false;
+  if (digitalRead(_irq) == LOW) _pen = true;
+  return true;
+}
+
+/*!
+    @brief  PENIRQ falling edge interrupt, latches the press.
+*/
+void TFT_Touch::penISR(void) {
+  if (_penTouch) _penTouch->_pen = true;
+}
+
+/*!
+    @brief  Runs a conversion and reads its 12-bit result. The touch
+            controller must be selected.
+    @param  cmd  Control byte of the conversion.
+    @return The 12-bit conversion result.
+*/
+uint16_t TFT_Touch::readChannel(uint8_t cmd) {
+  SPIClass *spi = _tft.hwspi._spi;
+
+  spi->transfer(cmd);
+  uint16_t hi = spi->transfer(0x00);
+  uint16_t lo = spi->transfer(0x00);
+  return ((hi << 8) | lo) >> 3;
+}
+
+/*!
+    @brief  Measures the touch pressure. The touch controller must be
+            selected.
+    @return 0 when not pressed, up to 4095 when pressed hard.
+*/
+uint16_t TFT_Touch::readPressure(void) {
+  int16_t z = readChannel(XPT2046_Z1) + 4095 - readChannel(XPT2046_Z2);
+  return z > 0 ? z : 0;
+}
+
+/*!
+    @brief  Sorts the samples of an axis, then averages them without the
+            lowest and highest ones.
+    @param  samples  The TFT_TOUCH_SAMPLES samples, sorted in place.
+    @param  result  Receives the average.
+    @return false if the kept samples spread over more than TFT_TOUCH_SPREAD.
+*/
+bool TFT_Touch::filter(uint16_t *samples, uint16_t *result) {
+  for (uint8_t i = 1; i < TFT_TOUCH_SAMPLES; i++) {
+    uint16_t value = samples[i];
+    uint8_t j = i;
+
+    for (; j > 0 && samples[j - 1] > value; j--) samples[j] = samples[j - 1];
+    samples[j] = value;
+  }
+
+  uint8_t first = TFT_TOUCH_SAMPLES > 2 ? 1 : 0;
+  uint8_t last = TFT_TOUCH_SAMPLES - 1 - first;
+  if (samples[last] - samples[first] > TFT_TOUCH_SPREAD) return false;
+
+  uint32_t sum = 0;
+  for (uint8_t i = first; i <= last; i++) sum += samples[i];
+  *result = sum / (last - first + 1);
+  return true;
+}
@@ -0,0 +1,107 @@
+/*!
+ * @file TFT_Touch.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_TOUCH_H_
+#define _TFT_TOUCH_H_
+
+#include "TFT_SPI.h"
+
+#ifndef TFT_TOUCH_FREQ
+#define TFT_TOUCH_FREQ 2000000L  ///< XPT2046 SPI clock, 2.5 MHz at most.
+#endif
+
+#ifndef TFT_TOUCH_SAMPLES
+#define TFT_TOUCH_SAMPLES 5  ///< Samples per axis, the extremes are dropped.
+#endif
+
+#ifndef TFT_TOUCH_Z_MIN
+#define TFT_TOUCH_Z_MIN 400  ///< Pressure below which the panel isn't touched.
+#endif
+
+#ifndef TFT_TOUCH_SPREAD
+#define TFT_TOUCH_SPREAD 64  ///< Widest spread of the kept samples, raw units.
+#endif
+
+#define XPT2046_X 0xD1    ///< Measure X, ADC kept on for the next conversion.
+#define XPT2046_Y 0x91    ///< Measure Y, ADC kept on for the next conversion.
+#define XPT2046_Z1 0xB1   ///< Measure Z1, ADC kept on for the next one.
+#define XPT2046_Z2 0xC1   ///< Measure Z2, ADC kept on for the next one.
+#define XPT2046_OFF 0xD0  ///< Measure X then power down, PENIRQ enabled.
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Touch reads the XPT2046 resistive touch controller found on
+          most ILI9341 modules, sharing the display's SPI bus with its own
+          chip select pin and bus settings. It only samples between display
+          transactions and, when its PENIRQ pin is wired, only once the pin
+          reports the panel is pressed, so no bus time is spent on an idle
+          panel. On a pin with an external interrupt (2, 3 and 7 on a
+          Leonardo, 2, 3 and 18 to 21 on a Mega 2560) the falling edge is
+          latched, so a tap made during a long draw call is still read.
+
+  @code
+    AVR_ILI9341 tft = AVR_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+    TFT_Touch touch(tft, TOUCH_CS, TOUCH_IRQ);
+
+    touch.begin();  // Before tft.begin(), to deselect the controller.
+    tft.begin();
+
+    uint16_t x, y;
+    if (touch.read(&x, &y)) tft.drawShape(x, y, 2, 2, 0, 0, 0, ILI9341_RED);
+  @endcode
+*/
+class TFT_Touch {
+ public:
+  TFT_Touch(TFT_SPI &tft, int8_t cs, int8_t irq = -1);
+
+  void begin(void);
+  void setCalibration(uint16_t xMin, uint16_t xMax, uint16_t yMin,
+                      uint16_t yMax);
+
+  bool touched(void);
+  bool readRaw(uint16_t *x, uint16_t *y, uint16_t *z);
+  bool read(uint16_t *x, uint16_t *y);
+
+ private:
+  bool penDown(void);
+  static void penISR(void);
+  uint16_t readChannel(uint8_t cmd);
+  uint16_t readPressure(void);
+  bool filter(uint16_t *samples, uint16_t *result);
+
+  TFT_SPI &_tft;       ///< Display sharing the bus, also gives the rotation.
+  int8_t _cs;          ///< Touch controller chip select pin #
+  int8_t _irq;         ///< PENIRQ pin # (or -1)
+  volatile bool _pen;  ///< PENIRQ fell since the pen was last seen up.
+
+  static TFT_Touch *_penTouch;  ///< Instance the PENIRQ interrupt latches.
+
+#if defined(SPI_HAS_TRANSACTION)
+  SPISettings _settings;  ///< Touch controller SPI transaction settings
+#endif
+
+  uint16_t _xMin, _xMax;  ///< Raw X at columns 0 and 239 at rotation 0.
+  uint16_t _yMin, _yMax;  ///< Raw Y at rows 0 and 319 at rotation 0.
+};
+
+#endif  // end _TFT_TOUCH_H_
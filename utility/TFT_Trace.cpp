@@ -0,0 +1,186 @@
+/*!
+ * @file TFT_Trace.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "TFT_Trace.h"
+
+#include <string.h>
+
+#if TFT_ENABLE_TRACE
+
+/*!
+    @brief   TFT_Trace constructor.
+    @param   out       Output the trace is written to, e.g. an open SD File.
+    @param   buffered  Hold each transaction's records in RAM until the display
+                       released the SPI bus. Pass false only for outputs off
+                       the bus, e.g. Serial, to trace transactions of any size.
+*/
+TFT_Trace::TFT_Trace(Print &out, bool buffered)
+    : _out(out), _buffered(buffered) {
+  _selected = false;
+  _runValue = 0;
+  _runCount = 0;
+  _used = 0;
+  _lost = 0;
+}
+
+/*!
+    @brief  Writes the trace header. Call once before attaching the trace to
+            a display with setTrace().
+*/
+void TFT_Trace::begin(void) {
+  _out.write((const uint8_t *)"TFTR", 4);
+  _out.write(TFT_TRACE_VERSION);
+}
+
+/*!
+    @brief  Writes the run still being merged. Call before closing the output.
+*/
+void TFT_Trace::flush(void) { endRun(); }
+
+/*!
+    @brief  Records a change of the chip select pin. Deselecting writes out the
+            records held for the transaction, so it must be recorded after the
+            display's SPI transaction ended.
+    @param  active  true when CS is driven low.
+*/
+void TFT_Trace::select(bool active) {
+  uint8_t rec = active ? TFT_TRACE_SELECT : TFT_TRACE_DESELECT;
+
+  if (active) {
+    endRun();
+    _selected = true;
+  } else {
+    _selected = false;
+    drain();
+    endRun();
+  }
+  record(&rec, 1);
+}
+
+/*!
+    @brief  Records a command byte.
+    @param  cmd  The byte sent with DC low.
+*/
+void TFT_Trace::command(uint8_t cmd) {
+  uint8_t rec[2] = {TFT_TRACE_COMMAND, cmd};
+
+  endRun();
+  record(rec, 2);
+}
+
+/*!
+    @brief  Records a single data byte.
+    @param  d8  The byte sent with DC high.
+*/
+void TFT_Trace::data(uint8_t d8) {
+  uint8_t rec[2] = {TFT_TRACE_DATA, d8};
+
+  endRun();
+  record(rec, 2);
+}
+
+/*!
+    @brief  Records 16-bit data, most significant byte first, repeated count
+            times. Consecutive runs of the same value are merged.
+    @param  value  The 16-bit value sent with DC high.
+    @param  count  Number of times the value is sent.
+*/
+void TFT_Trace::run(uint16_t value, uint32_t count) {
+  if (count == 0) return;
+  if (_runCount > 0 && value != _runValue) endRun();
+
+  _runValue = value;
+  _runCount += count;
+}
+
+/*!
+    @brief  Records bytes read from the display.
+    @param  count  Number of bytes clocked in.
+*/
+void TFT_Trace::read(uint32_t count) {
+  uint8_t rec[6] = {TFT_TRACE_READ};
+
+  endRun();
+  record(rec, 1 + encodeCount(rec + 1, count));
+}
+
+/*!
+    @brief  Records the run being merged, if any.
+*/
+void TFT_Trace::endRun(void) {
+  if (_runCount == 0) return;
+
+  uint8_t rec[8] = {TFT_TRACE_RUN, (uint8_t)(_runValue >> 8),
+                    (uint8_t)(_runValue & 0xFF)};
+  record(rec, 3 + encodeCount(rec + 3, _runCount));
+  _runCount = 0;
+}
+
+/*!
+    @brief  Writes out the records held for the transaction, followed by the
+            number of records that did not fit, if any.
+*/
+void TFT_Trace::drain(void) {
+  if (_used > 0) _out.write(_buffer, _used);
+  _used = 0;
+
+  if (_lost > 0) {
+    uint8_t rec[6] = {TFT_TRACE_LOST};
+    _out.write(rec, 1 + encodeCount(rec + 1, _lost));
+    _lost = 0;
+  }
+}
+
+/*!
+    @brief  Writes a record, or holds it while the display is selected. A
+            record that does not fit the buffer is dropped whole and counted.
+    @param  rec  The tag byte and its arguments.
+    @param  len  Length of the record in bytes.
+*/
+void TFT_Trace::record(const uint8_t *rec, uint8_t len) {
+  if (!_buffered || !_selected) {
+    _out.write(rec, len);
+  } else if (_used + len <= TFT_TRACE_BUFFER) {
+    memcpy(_buffer + _used, rec, len);
+    _used += len;
+  } else if (_lost < 0xFFFF) {
+    _lost++;
+  }
+}
+
+/*!
+    @brief  Encodes a count as a varint, 7 bits at a time.
+    @param  out    Receives up to 5 bytes.
+    @param  count  The count to encode.
+    @return Number of bytes written to out.
+*/
+uint8_t TFT_Trace::encodeCount(uint8_t *out, uint32_t count) {
+  uint8_t len = 0;
+
+  while (count >= 0x80) {
+    out[len++] = (uint8_t)(count | 0x80);
+    count >>= 7;
+  }
+  out[len++] = (uint8_t)count;
+  return len;
+}
+
+#endif  // TFT_ENABLE_TRACE
@@ -0,0 +1,99 @@
+/*!
+ * @file TFT_Trace.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_TRACE_H_
+#define _TFT_TRACE_H_
+
+#include <Print.h>
+
+#include "TFT_Config.h"
+
+#if TFT_ENABLE_TRACE
+
+// TRACE FORMAT
+// -----------------------------------------------------------------------------
+// A trace starts with the 4 bytes "TFTR" and the format version, followed by
+// records made of a tag byte and its arguments. Counts are varints: 7 bits per
+// byte, least significant first, the top bit set on all but the last byte.
+// extras/trace_replay.py decodes traces.
+
+#define TFT_TRACE_VERSION 2  ///< Trace format version.
+
+#define TFT_TRACE_SELECT 0x01    ///< CS driven low, transaction started.
+#define TFT_TRACE_DESELECT 0x02  ///< CS driven high, transaction ended.
+#define TFT_TRACE_COMMAND 0x03   ///< <byte> sent with DC low.
+#define TFT_TRACE_DATA 0x04      ///< <byte> sent with DC high.
+#define TFT_TRACE_RUN 0x05       ///< <hi> <lo> <count> repeated 16-bit data.
+#define TFT_TRACE_READ 0x06      ///< <count> bytes clocked in with DC high.
+#define TFT_TRACE_LOST 0x07      ///< <count> records of the transaction lost.
+
+// RAM holding the records of one transaction when buffered: the output may sit
+// on the display's SPI bus, so it is only written once the display released it.
+#ifndef TFT_TRACE_BUFFER
+#define TFT_TRACE_BUFFER 192  ///< Bytes of records buffered per transaction.
+#endif
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Trace records the byte stream a TFT_SPI display emits, with the
+          DC and CS state, to any Print output such as an SD card File.
+          Repeated 16-bit data, i.e. pixel fills, is run-length encoded.
+
+          By default the records of a transaction are held in RAM and written
+          once the display's CS is high and its SPI transaction ended, as an SD
+          card shares the bus. A transaction outgrowing TFT_TRACE_BUFFER loses
+          its later records, which the trace marks with TFT_TRACE_LOST. Outputs
+          off the bus, e.g. Serial, can be written straight away instead.
+*/
+class TFT_Trace {
+ public:
+  TFT_Trace(Print &out, bool buffered = true);
+
+  void begin(void);
+  void flush(void);
+
+  void select(bool active);
+  void command(uint8_t cmd);
+  void data(uint8_t d8);
+  void run(uint16_t value, uint32_t count);
+  void read(uint32_t count);
+
+ private:
+  void endRun(void);
+  void drain(void);
+  void record(const uint8_t *rec, uint8_t len);
+  static uint8_t encodeCount(uint8_t *out, uint32_t count);
+
+  Print &_out;           ///< Output the records are written to.
+  bool _buffered;        ///< Hold the records while the display is selected.
+  bool _selected;        ///< The display's CS is low.
+  uint16_t _runValue;    ///< Value of the run being merged.
+  uint32_t _runCount;    ///< Length of the run being merged, 0 for none.
+  uint16_t _used;        ///< Bytes held in _buffer.
+  uint16_t _lost;        ///< Records of this transaction that did not fit.
+  uint8_t _buffer[TFT_TRACE_BUFFER];  ///< Records of the open transaction.
+};
+
+#endif  // TFT_ENABLE_TRACE
+
+#endif  // end _TFT_TRACE_H_
@@ -0,0 +1,135 @@
+/*!
+ * @file TFT_Wall.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "TFT_Wall.h"
+
+/*!
+    @brief   TFT_Wall constructor.
+    @param   w  Wall width in pixels, usually the sum of the panel widths
+                along a row of tiles.
+    @param   h  Wall height in pixels, usually the sum of the panel heights
+                along a column of tiles.
+*/
+TFT_Wall::TFT_Wall(uint16_t w, uint16_t h) : TFT_GFX(w, h) {
+  _tileCount = 0;
+  _x1 = _y1 = _x2 = _y2 = 0;
+}
+
+/*!
+    @brief  Adds a panel to the wall. The panel must have been started with
+            its begin() function and rotated to match its physical mounting
+            before drawing on the wall. Its size on the wall follows its
+            current rotation.
+    @param  panel  The panel to tile into the wall.
+    @param  x  Wall x coordinate of the panel's top-left corner.
+    @param  y  Wall y coordinate of the panel's top-left corner.
+    @return true if the panel was added, false if the wall is already full.
+*/
+bool TFT_Wall::addPanel(TFT_SPI &panel, uint16_t x, uint16_t y) {
+  if (_tileCount >= TFT_WALL_MAX_PANELS) return false;
+
+  _tiles[_tileCount].panel = &panel;
+  _tiles[_tileCount].x = x;
+  _tiles[_tileCount].y = y;
+  _tileCount++;
+  return true;
+}
+
+/*!
+    @brief   Stores the wall "address window". Nothing is sent to the panels
+             until the pixel count is known in writeData16().
+    @param   x1  Wall start column.
+    @param   y1  Wall start row.
+    @param   x2  Wall end column.
+    @param   y2  Wall end row.
+*/
+void TFT_Wall::setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2,
+                                uint16_t y2) {
+  _x1 = x1;
+  _y1 = y1;
+  _x2 = x2;
+  _y2 = y2;
+}
+
+/*!
+    @brief  Fills the current wall window row by row with up to num pixels.
+            Full rows go out as one rectangle and a partial last row as a
+            second, one row high, so no pixel beyond num is drawn.
+    @param  color  16-bit pixel color in '565' RGB format.
+    @param  num   Number of pixels to draw, filling the window row by row.
+*/
+void TFT_Wall::writeData16(uint16_t color, uint32_t num) {
+  if (_x2 < _x1 || _y2 < _y1 || num == 0) return;
+
+  uint16_t cols = _x2 - _x1 + 1;
+  uint32_t rows = num / cols;  // Full rows covered by the pixels.
+  uint32_t rest = num % cols;
+  if (rows >= (uint32_t)(_y2 - _y1 + 1)) {
+    rows = _y2 - _y1 + 1;
+    rest = 0;
+  }
+
+  if (rows > 0) writeRect(color, _x1, _y1, _x2, _y1 + rows - 1);
+  if (rest > 0) {
+    uint16_t y = _y1 + rows;
+    writeRect(color, _x1, y, _x1 + rest - 1, y);
+  }
+}
+
+/*!
+    @brief  Splits a wall rectangle at the panel boundaries and streams the
+            clipped part of it to every intersecting panel, each in a single
+            bus transaction.
+    @param  color  16-bit pixel color in '565' RGB format.
+    @param  x1  Wall start column.
+    @param  y1  Wall start row.
+    @param  x2  Wall end column.
+    @param  y2  Wall end row.
+*/
+void TFT_Wall::writeRect(uint16_t color, uint16_t x1, uint16_t y1, uint16_t x2,
+                         uint16_t y2) {
+  for (uint8_t i = 0; i < _tileCount; i++) {
+    TFT_SPI *panel = _tiles[i].panel;
+    uint16_t px1 = _tiles[i].x;
+    uint16_t py1 = _tiles[i].y;
+    uint16_t px2 = px1 + panel->width() - 1;
+    uint16_t py2 = py1 + panel->height() - 1;
+
+    // Skip the panels the rectangle doesn't intersect.
+    if (x1 > px2 || x2 < px1 || y1 > py2 || y2 < py1) continue;
+
+    // Clip the rectangle to the panel then move it to panel coordinates.
+    uint16_t lx1 = (x1 > px1 ? x1 : px1) - px1;
+    uint16_t lx2 = (x2 < px2 ? x2 : px2) - px1;
+    uint16_t ly1 = (y1 > py1 ? y1 : py1) - py1;
+    uint16_t ly2 = (y2 < py2 ? y2 : py2) - py1;
+
+    panel->setAddressWindow(lx1, ly1, lx2, ly2);  // Starts the transaction.
+    panel->writeData16(color, (uint32_t)(lx2 - lx1 + 1) * (ly2 - ly1 + 1));
+    panel->SPI_END();
+  }
+}
+
+/*!
+    @brief  Ends the wall window. Nothing to do, each panel's transaction was
+            already ended by writeData16().
+*/
+void TFT_Wall::endWrite(void) {}
@@ -0,0 +1,78 @@
+/*!
+ * @file TFT_Wall.h
+ *
+ * @section intro_sec Introduction
+ *
+ * This file is part AVR_ILI9341 library package files. It is an implementation
+ * of the TFT Display using the chipset ILI9341V and been optimised mainly
+ * for Leonardo and Mega 2560 boards. It may work with other AVR boards but
+ * that cannot be guaranteed.
+ *
+ * @section author Author
+ *
+ * Originally written by Limor "ladyada" Fried for Adafruit Industries,
+ * with contributions from the open source community.
+ * Improved by dmigwi (Daniel Migwi)  @2024
+ *
+ *  @section license License
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _TFT_WALL_H_
+#define _TFT_WALL_H_
+
+#include "TFT_SPI.h"
+
+#ifndef TFT_WALL_MAX_PANELS
+#define TFT_WALL_MAX_PANELS 4  ///< Maximum panels tiled into a single wall.
+#endif
+
+// CLASS DEFINITION
+// -----------------------------------------------------------------------------
+
+/*!
+  @brief  TFT_Wall is a single logical TFT_GFX canvas spanning several tiled
+          panels sharing the SPI bus, each with its own chip select pin.
+          Every span drawn on the wall is split at the panel boundaries and
+          sent to each intersecting panel in one bus transaction.
+*/
+class TFT_Wall : public TFT_GFX {
+ public:
+  // CONSTRUCTOR
+  // ---------------------------------------------------------------------------
+
+  TFT_Wall(uint16_t w, uint16_t h);
+
+  // DESTRUCTOR
+  // ---------------------------------------------------------------------------
+
+  virtual ~TFT_Wall(){};
+
+  bool addPanel(TFT_SPI &panel, uint16_t x, uint16_t y);
+
+ protected:
+  void setAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+  void writeData16(uint16_t color, uint32_t num);
+  void endWrite(void);
+
+ private:
+  void writeRect(uint16_t color, uint16_t x1, uint16_t y1, uint16_t x2,
+                 uint16_t y2);
+
+  /*!
+    @brief  A panel tile and the origin of its top-left corner on the wall.
+  */
+  struct Tile {
+    TFT_SPI *panel;  ///< Panel already initialised and rotated by the caller.
+    uint16_t x;      ///< Wall x coordinate of the panel's column 0.
+    uint16_t y;      ///< Wall y coordinate of the panel's row 0.
+  };
+
+  Tile _tiles[TFT_WALL_MAX_PANELS];  ///< Registered panel tiles.
+  uint8_t _tileCount;                ///< Number of registered tiles.
+
+  uint16_t _x1, _y1, _x2, _y2;  ///< Current wall address window.
+};
+
+#endif  // end _TFT_WALL_H_